@@ -0,0 +1,380 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "compressed_set.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Blocos com menos chaves que isso tentam se juntar ao vizinho
+#define CSET_MERGE_THRESHOLD (CSET_BLOCK_MAX / 4)
+
+// Inverte o bit de sinal: a ordem dos int vira a ordem dos uint32_t
+static uint32_t toUnsigned(int key)  { return (uint32_t)key ^ 0x80000000u; }
+static int fromUnsigned(uint32_t x)  { return (int)(x ^ 0x80000000u); }
+
+static void* allocOrDie(size_t bytes)
+{
+    void* memory = malloc(bytes);
+
+    if(memory == NULL)
+    {
+        printf("Wasn't possible grow the compressed set due lacking of memory.");
+        exit(1);
+    }
+
+    return memory;
+}
+
+// === Block encoding ===
+
+static size_t packedWords(size_t count, int width)
+{
+    // +1 palavra de folga: a leitura sempre busca 64 bits
+    return (count > 0 ? ((count - 1) * width + 31) / 32 : 0) + 1;
+}
+
+static void encodeBlock(CsetBlock* block, const uint32_t* keys, size_t count)
+{
+    uint32_t largest = 0;
+    for(size_t i = 1; i < count; i++)
+    {
+        uint32_t delta = keys[i] - keys[i - 1];
+        if(delta > largest) largest = delta;
+    }
+
+    int width = 0;
+    while(width < 32 && (largest >> width) != 0) width++;
+
+    size_t words = packedWords(count, width);
+    free(block->packed);
+    block->packed = (uint32_t*)allocOrDie(sizeof(uint32_t) * words);
+    memset(block->packed, 0, sizeof(uint32_t) * words);
+
+    block->first = keys[0];
+    block->count = (uint16_t)count;
+    block->width = (uint8_t)width;
+
+    size_t bit = 0;
+    for(size_t i = 1; i < count; i++, bit += width)
+    {
+        uint64_t delta = (uint64_t)(keys[i] - keys[i - 1]) << (bit & 31);
+        block->packed[bit >> 5] |= (uint32_t)delta;
+        if((bit & 31) + width > 32) block->packed[(bit >> 5) + 1] |= (uint32_t)(delta >> 32);
+    }
+}
+
+// Soma de prefixos in-place: com SSE2, quatro posições por passo
+static void prefixSum(uint32_t* values, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    __m128i carry = _mm_setzero_si128();
+    for(; i + 4 <= count; i += 4)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(values + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128((__m128i*)(values + i), x);
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+#endif
+
+    // Restante (ou tudo, sem SSE2) de forma escalar
+    if(i == 0) i = 1;
+    for(; i < count; i++) values[i] += values[i - 1];
+}
+
+// Decodifica o bloco inteiro em `out` (chaves em ordem)
+static size_t decodeBlock(const CsetBlock* block, uint32_t* out)
+{
+    const uint32_t mask = block->width == 32 ? 0xffffffffu : ((1u << block->width) - 1);
+
+    out[0] = block->first;
+
+    size_t bit = 0;
+    for(size_t i = 1; i < block->count; i++, bit += block->width)
+    {
+        size_t word = bit >> 5;
+        uint64_t window = block->packed[word] | ((uint64_t)block->packed[word + 1] << 32);
+        out[i] = (uint32_t)(window >> (bit & 31)) & mask;
+    }
+
+    prefixSum(out, block->count);
+    return block->count;
+}
+
+// Primeira posição com valor >= x
+static size_t lowerBound(const uint32_t* keys, size_t count, uint32_t x)
+{
+    size_t lo = 0;
+    size_t hi = count;
+
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(keys[mid] < x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+// === Directory and Fenwick tree ===
+
+// Último bloco cuja primeira chave é <= x (ou 0 se x vem antes de todos)
+static size_t locateBlock(const CompressedSet* set, uint32_t x)
+{
+    size_t lo = 0;
+    size_t hi = set->blockCount;
+
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(set->blocks[mid].first <= x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo > 0 ? lo - 1 : 0;
+}
+
+static void fenwickAdd(CompressedSet* set, size_t block, long delta)
+{
+    for(size_t i = block + 1; i <= set->blockCount; i += i & (~i + 1))
+    {
+        set->fenwick[i] += (size_t)delta;
+    }
+}
+
+// Soma das contagens dos blocos [0, block)
+static size_t fenwickPrefix(const CompressedSet* set, size_t block)
+{
+    size_t sum = 0;
+    for(size_t i = block; i > 0; i -= i & (~i + 1))
+    {
+        sum += set->fenwick[i];
+    }
+    return sum;
+}
+
+static void rebuildFenwick(CompressedSet* set)
+{
+    memset(set->fenwick, 0, sizeof(size_t) * (set->blockCapacity + 1));
+    for(size_t i = 1; i <= set->blockCount; i++)
+    {
+        set->fenwick[i] += set->blocks[i - 1].count;
+        size_t parent = i + (i & (~i + 1));
+        if(parent <= set->blockCount) set->fenwick[parent] += set->fenwick[i];
+    }
+}
+
+// Abre espaço para um bloco vazio na posição `at`
+static CsetBlock* insertBlockAt(CompressedSet* set, size_t at)
+{
+    if(set->blockCount == set->blockCapacity)
+    {
+        size_t capacity = set->blockCapacity ? set->blockCapacity * 2 : 4;
+        CsetBlock* blocks = (CsetBlock*)realloc(set->blocks, sizeof(CsetBlock) * capacity);
+        size_t* fenwick = (size_t*)realloc(set->fenwick, sizeof(size_t) * (capacity + 1));
+        if(blocks == NULL || fenwick == NULL)
+        {
+            printf("Wasn't possible grow the compressed set due lacking of memory.");
+            exit(1);
+        }
+        set->blocks = blocks;
+        set->fenwick = fenwick;
+        set->blockCapacity = capacity;
+    }
+
+    memmove(&set->blocks[at + 1], &set->blocks[at], sizeof(CsetBlock) * (set->blockCount - at));
+    set->blockCount++;
+    memset(&set->blocks[at], 0, sizeof(CsetBlock));
+    return &set->blocks[at];
+}
+
+static void removeBlockAt(CompressedSet* set, size_t at)
+{
+    free(set->blocks[at].packed);
+    memmove(&set->blocks[at], &set->blocks[at + 1], sizeof(CsetBlock) * (set->blockCount - at - 1));
+    set->blockCount--;
+}
+
+// === Public functions ===
+
+void csetInit(CompressedSet* set)
+{
+    set->blocks = NULL;
+    set->blockCount = 0;
+    set->blockCapacity = 0;
+    set->fenwick = NULL;
+    set->size = 0;
+}
+
+int csetInsert(CompressedSet* set, int key)
+{
+    uint32_t x = toUnsigned(key);
+    uint32_t keys[CSET_BLOCK_MAX + 1];
+
+    if(set->blockCount == 0)
+    {
+        encodeBlock(insertBlockAt(set, 0), &x, 1);
+        rebuildFenwick(set);
+        set->size = 1;
+        return 1;
+    }
+
+    size_t b = locateBlock(set, x);
+    size_t count = decodeBlock(&set->blocks[b], keys);
+    size_t pos = lowerBound(keys, count, x);
+    if(pos < count && keys[pos] == x) return 0;
+
+    memmove(&keys[pos + 1], &keys[pos], sizeof(uint32_t) * (count - pos));
+    keys[pos] = x;
+    count++;
+    set->size++;
+
+    if(count <= CSET_BLOCK_MAX)
+    {
+        encodeBlock(&set->blocks[b], keys, count);
+        fenwickAdd(set, b, 1);
+        return 1;
+    }
+
+    // Bloco cheio: divide ao meio
+    size_t half = count / 2;
+    encodeBlock(&set->blocks[b], keys, half);
+    encodeBlock(insertBlockAt(set, b + 1), keys + half, count - half);
+    rebuildFenwick(set);
+    return 1;
+}
+
+int csetDelete(CompressedSet* set, int key)
+{
+    if(set->blockCount == 0) return 0;
+
+    uint32_t x = toUnsigned(key);
+    uint32_t keys[2 * CSET_BLOCK_MAX];
+
+    size_t b = locateBlock(set, x);
+    size_t count = decodeBlock(&set->blocks[b], keys);
+    size_t pos = lowerBound(keys, count, x);
+    if(pos == count || keys[pos] != x) return 0;
+
+    memmove(&keys[pos], &keys[pos + 1], sizeof(uint32_t) * (count - pos - 1));
+    count--;
+    set->size--;
+
+    if(count == 0)
+    {
+        removeBlockAt(set, b);
+        rebuildFenwick(set);
+        return 1;
+    }
+
+    // Bloco pequeno: junta com o próximo se couber
+    if(count < CSET_MERGE_THRESHOLD && b + 1 < set->blockCount
+       && count + set->blocks[b + 1].count <= CSET_BLOCK_MAX)
+    {
+        count += decodeBlock(&set->blocks[b + 1], keys + count);
+        removeBlockAt(set, b + 1);
+        encodeBlock(&set->blocks[b], keys, count);
+        rebuildFenwick(set);
+        return 1;
+    }
+
+    encodeBlock(&set->blocks[b], keys, count);
+    fenwickAdd(set, b, -1);
+    return 1;
+}
+
+int csetContains(const CompressedSet* set, int key)
+{
+    if(set->blockCount == 0) return 0;
+
+    uint32_t x = toUnsigned(key);
+    uint32_t keys[CSET_BLOCK_MAX];
+
+    size_t count = decodeBlock(&set->blocks[locateBlock(set, x)], keys);
+    size_t pos = lowerBound(keys, count, x);
+    return pos < count && keys[pos] == x;
+}
+
+size_t csetRank(const CompressedSet* set, int key)
+{
+    if(set->blockCount == 0) return 0;
+
+    uint32_t x = toUnsigned(key);
+    uint32_t keys[CSET_BLOCK_MAX];
+
+    size_t b = locateBlock(set, x);
+    size_t count = decodeBlock(&set->blocks[b], keys);
+    return fenwickPrefix(set, b) + lowerBound(keys, count, x);
+}
+
+size_t csetMemoryUsage(const CompressedSet* set)
+{
+    size_t bytes = sizeof(CompressedSet)
+                 + sizeof(CsetBlock) * set->blockCapacity
+                 + sizeof(size_t) * (set->blockCapacity + 1);
+
+    for(size_t i = 0; i < set->blockCount; i++)
+    {
+        bytes += sizeof(uint32_t) * packedWords(set->blocks[i].count, set->blocks[i].width);
+    }
+
+    return bytes;
+}
+
+void csetIterBegin(CsetIterator* it, const CompressedSet* set)
+{
+    it->set = set;
+    it->block = 0;
+    it->index = 0;
+    it->count = set->blockCount > 0 ? decodeBlock(&set->blocks[0], it->buffer) : 0;
+}
+
+int csetIterNext(CsetIterator* it, int* out)
+{
+    if(it->index == it->count)
+    {
+        if(it->block + 1 >= it->set->blockCount) return 0;
+
+        it->block++;
+        it->index = 0;
+        it->count = decodeBlock(&it->set->blocks[it->block], it->buffer);
+    }
+
+    *out = fromUnsigned(it->buffer[it->index++]);
+    return 1;
+}
+
+void csetInOrderTraversal(const CompressedSet* set)
+{
+    CsetIterator it;
+    int key;
+
+    csetIterBegin(&it, set);
+    while(csetIterNext(&it, &key))
+    {
+        printf("%d ", key);
+    }
+}
+
+void csetFree(CompressedSet* set)
+{
+    for(size_t i = 0; i < set->blockCount; i++)
+    {
+        free(set->blocks[i].packed);
+    }
+
+    free(set->blocks);
+    free(set->fenwick);
+    csetInit(set);
+}
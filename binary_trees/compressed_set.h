@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Maximum number of keys per block
+#define CSET_BLOCK_MAX 128
+
+// Sorted run of keys stored as the first key plus bit-packed deltas
+typedef struct
+{
+    uint32_t first;    // First key (order-preserving unsigned form)
+    uint16_t count;
+    uint8_t width;     // Bits per delta
+    uint32_t* packed;  // count - 1 deltas of `width` bits, plus one spare word
+} CsetBlock;
+
+// Compressed ordered set of ints. Blocks are kept in a sorted directory that is
+// searched as an implicit binary tree, and a Fenwick tree over the block sizes
+// answers rank queries. Dense ID sets cost about one byte per key or less.
+typedef struct
+{
+    CsetBlock* blocks;
+    size_t blockCount;
+    size_t blockCapacity;
+    size_t* fenwick;   // 1-based Fenwick tree over blocks[i].count
+    size_t size;
+} CompressedSet;
+
+// In-order iterator (decodes one block at a time)
+typedef struct
+{
+    const CompressedSet* set;
+    size_t block;
+    size_t index;
+    size_t count;
+    uint32_t buffer[CSET_BLOCK_MAX];
+} CsetIterator;
+
+/**
+ * @brief Initializes an empty compressed set.
+ * @param set A pointer to the structure to be initialized.
+ */
+void csetInit(CompressedSet* set);
+
+/**
+ * @brief Inserts a key, re-encoding (and splitting, if full) its block.
+ * @param set A pointer to the compressed set.
+ * @param key The key to be inserted.
+ * @return 1 if the key was inserted, 0 if it was already present.
+ */
+int csetInsert(CompressedSet* set, int key);
+
+/**
+ * @brief Deletes a key, re-encoding (and merging, if small) its block.
+ * @param set A pointer to the compressed set.
+ * @param key The key to be deleted.
+ * @return 1 if the key was deleted, 0 if it was not present.
+ */
+int csetDelete(CompressedSet* set, int key);
+
+/**
+ * @brief Checks whether a key is present (decodes a single block).
+ * @param set A pointer to the compressed set.
+ * @param key The key to be checked.
+ * @return 1 if the key is present, 0 otherwise.
+ */
+int csetContains(const CompressedSet* set, int key);
+
+/**
+ * @brief Counts the keys strictly smaller than `key` in O(log n) plus one block decode.
+ * @param set A pointer to the compressed set.
+ * @param key The reference key (does not need to be present).
+ * @return The rank of `key`.
+ */
+size_t csetRank(const CompressedSet* set, int key);
+
+/**
+ * @brief Returns the number of bytes used by the set (directory, Fenwick tree and blocks).
+ * @param set A pointer to the compressed set.
+ * @return The memory usage in bytes.
+ */
+size_t csetMemoryUsage(const CompressedSet* set);
+
+/**
+ * @brief Starts an in-order iteration.
+ * @param it A pointer to the iterator.
+ * @param set A pointer to the compressed set (must not change during the iteration).
+ */
+void csetIterBegin(CsetIterator* it, const CompressedSet* set);
+
+/**
+ * @brief Returns the next key of the iteration.
+ * @param it A pointer to the iterator.
+ * @param out Receives the next key.
+ * @return 1 if a key was returned, 0 at the end.
+ */
+int csetIterNext(CsetIterator* it, int* out);
+
+/**
+ * @brief Prints every key in order.
+ * @param set A pointer to the compressed set.
+ */
+void csetInOrderTraversal(const CompressedSet* set);
+
+/**
+ * @brief Frees every block and the directory.
+ * @param set A pointer to the compressed set.
+ * @note Call csetInit again before reusing the structure.
+ */
+void csetFree(CompressedSet* set);
@@ -0,0 +1,299 @@
+/*
+Benchmark das filas de prioridade (priority_queue.c) contra a AVL do
+tree_template usada como fila (insertAVL + findMinValue + deleteNodeAVL).
+
+Cenários:
+  - push/pop:      insere n chaves distintas e retira todas em ordem
+  - decrease-key:  insere n chaves, diminui m delas (como no Dijkstra) e esvazia
+  - meld:          monta várias filas pequenas, junta todas e esvazia
+
+Compilar: gcc -O2 heap_benchmark.c priority_queue.c tree_template.c -o heap_benchmark
+Uso:      ./heap_benchmark [chaves] [diminuicoes]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tree_template.h"
+#include "priority_queue.h"
+
+#define MELD_QUEUES 64
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int rngState = 88172645u;
+static unsigned int nextRandom(void)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void shuffle(int* keys, int n)
+{
+    for(int i = n - 1; i > 0; i--)
+    {
+        int j = (int)(nextRandom() % (unsigned int)(i + 1));
+        int temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+}
+
+static void printRow(const char* name, double seconds, int operations, unsigned long long checksum)
+{
+    printf("  %-14s %8.1f ns/op   (checksum %llx)\n", name, seconds * 1e9 / operations, checksum);
+}
+
+// Retira o menor da AVL: uma descida para achar e outra para remover
+static int avlPop(Node** root, int* key)
+{
+    if(*root == NULL) return 0;
+
+    *key = findMinValue(*root)->data;
+    *root = deleteNodeAVL(*root, *key);
+    return 1;
+}
+
+// === push/pop ===
+
+static void runPushPop(const int* keys, int n)
+{
+    unsigned long long checksum;
+    int key;
+
+    printf("\npush/pop (%d chaves)\n", n);
+
+    for(int arity = 2; arity <= 8; arity *= 2)
+    {
+        DaryHeap heap;
+        char name[32];
+
+        dheapInit(&heap, arity);
+        checksum = 0;
+
+        double t = nowSeconds();
+        for(int i = 0; i < n; i++) dheapPush(&heap, keys[i]);
+        while(dheapPop(&heap, &key)) checksum = checksum * 31 + key;
+
+        snprintf(name, sizeof(name), "heap %d-ario", arity);
+        printRow(name, nowSeconds() - t, 2 * n, checksum);
+        dheapFree(&heap);
+    }
+
+    PairingHeap pairing;
+    pairingInit(&pairing);
+    checksum = 0;
+
+    double t = nowSeconds();
+    for(int i = 0; i < n; i++) pairingPush(&pairing, keys[i]);
+    while(pairingPop(&pairing, &key)) checksum = checksum * 31 + key;
+    printRow("pairing heap", nowSeconds() - t, 2 * n, checksum);
+
+    Node* root = NULL;
+    checksum = 0;
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) root = insertAVL(root, keys[i]);
+    while(avlPop(&root, &key)) checksum = checksum * 31 + key;
+    printRow("AVL", nowSeconds() - t, 2 * n, checksum);
+}
+
+// === decrease-key ===
+
+// Sorteia as diminuições antes de medir, garantindo chaves distintas (a AVL
+// não aceita repetidas): item[i] passa a ter a chave newKey[i]
+static int planDecreases(const int* keys, int n, int m, int* item, int* newKey)
+{
+    int range = 8 * n;
+    int* current = (int*)malloc(sizeof(int) * n);
+    unsigned char* used = (unsigned char*)calloc(range, 1);
+    int planned = 0;
+
+    if(current == NULL || used == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        exit(1);
+    }
+
+    for(int i = 0; i < n; i++)
+    {
+        current[i] = keys[i];
+        used[keys[i]] = 1;
+    }
+
+    for(int i = 0; i < m; i++)
+    {
+        int target = (int)(nextRandom() % (unsigned int)n);
+        int candidate = current[target] - 1 - (int)(nextRandom() % 64);
+        if(candidate < 0 || used[candidate]) continue;
+
+        used[current[target]] = 0;
+        used[candidate] = 1;
+        current[target] = candidate;
+        item[planned] = target;
+        newKey[planned] = candidate;
+        planned++;
+    }
+
+    free(current);
+    free(used);
+    return planned;
+}
+
+static void runDecreaseKey(const int* keys, int n, int m)
+{
+    int* item = (int*)malloc(sizeof(int) * m);
+    int* newKey = (int*)malloc(sizeof(int) * m);
+    int* current = (int*)malloc(sizeof(int) * n);
+    int* handles = (int*)malloc(sizeof(int) * n);
+    PairingNode** nodes = (PairingNode**)malloc(sizeof(PairingNode*) * n);
+    unsigned long long checksum;
+    int key;
+
+    if(item == NULL || newKey == NULL || current == NULL || handles == NULL || nodes == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        exit(1);
+    }
+
+    // As chaves vão de 7 a 8n - 1, espaçadas de 8 para caber as diminuições
+    m = planDecreases(keys, n, m, item, newKey);
+    printf("\ndecrease-key (%d chaves, %d diminuicoes)\n", n, m);
+
+    for(int arity = 2; arity <= 8; arity *= 2)
+    {
+        DaryHeap heap;
+        char name[32];
+
+        dheapInit(&heap, arity);
+        checksum = 0;
+
+        double t = nowSeconds();
+        for(int i = 0; i < n; i++) handles[i] = dheapPush(&heap, keys[i]);
+        for(int i = 0; i < m; i++) dheapDecreaseKey(&heap, handles[item[i]], newKey[i]);
+        while(dheapPop(&heap, &key)) checksum = checksum * 31 + key;
+
+        snprintf(name, sizeof(name), "heap %d-ario", arity);
+        printRow(name, nowSeconds() - t, 2 * n + m, checksum);
+        dheapFree(&heap);
+    }
+
+    PairingHeap pairing;
+    pairingInit(&pairing);
+    checksum = 0;
+
+    double t = nowSeconds();
+    for(int i = 0; i < n; i++) nodes[i] = pairingPush(&pairing, keys[i]);
+    for(int i = 0; i < m; i++) pairingDecreaseKey(&pairing, nodes[item[i]], newKey[i]);
+    while(pairingPop(&pairing, &key)) checksum = checksum * 31 + key;
+    printRow("pairing heap", nowSeconds() - t, 2 * n + m, checksum);
+
+    // Na AVL, diminuir a chave é remover a antiga e inserir a nova
+    Node* root = NULL;
+    checksum = 0;
+    for(int i = 0; i < n; i++) current[i] = keys[i];
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) root = insertAVL(root, keys[i]);
+    for(int i = 0; i < m; i++)
+    {
+        root = deleteNodeAVL(root, current[item[i]]);
+        root = insertAVL(root, newKey[i]);
+        current[item[i]] = newKey[i];
+    }
+    while(avlPop(&root, &key)) checksum = checksum * 31 + key;
+    printRow("AVL", nowSeconds() - t, 2 * n + m, checksum);
+
+    free(item);
+    free(newKey);
+    free(current);
+    free(handles);
+    free(nodes);
+}
+
+// === meld ===
+
+static void runMeld(const int* keys, int n)
+{
+    unsigned long long checksum = 0;
+    int key;
+
+    printf("\nmeld (%d filas, %d chaves no total)\n", MELD_QUEUES, n);
+
+    // Pairing heap: a junção é O(1) por fila
+    PairingHeap queues[MELD_QUEUES];
+    for(int q = 0; q < MELD_QUEUES; q++) pairingInit(&queues[q]);
+
+    double t = nowSeconds();
+    for(int i = 0; i < n; i++) pairingPush(&queues[i % MELD_QUEUES], keys[i]);
+    for(int q = 1; q < MELD_QUEUES; q++) pairingMeld(&queues[0], &queues[q]);
+    while(pairingPop(&queues[0], &key)) checksum = checksum * 31 + key;
+    printRow("pairing heap", nowSeconds() - t, 2 * n, checksum);
+
+    // Heap d-ário: sem junção barata, reinsere tudo na primeira fila
+    DaryHeap heaps[MELD_QUEUES];
+    for(int q = 0; q < MELD_QUEUES; q++) dheapInit(&heaps[q], 4);
+    checksum = 0;
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) dheapPush(&heaps[i % MELD_QUEUES], keys[i]);
+    for(int q = 1; q < MELD_QUEUES; q++)
+    {
+        for(int i = 0; i < heaps[q].size; i++) dheapPush(&heaps[0], heaps[q].keys[i]);
+        dheapFree(&heaps[q]);
+    }
+    while(dheapPop(&heaps[0], &key)) checksum = checksum * 31 + key;
+    printRow("heap 4-ario", nowSeconds() - t, 2 * n, checksum);
+    dheapFree(&heaps[0]);
+
+    // AVL: os intervalos das filas se sobrepõem, então joinAVL não serve;
+    // cada chave das outras árvores é retirada e inserida na primeira
+    Node* trees[MELD_QUEUES] = { NULL };
+    checksum = 0;
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) trees[i % MELD_QUEUES] = insertAVL(trees[i % MELD_QUEUES], keys[i]);
+    for(int q = 1; q < MELD_QUEUES; q++)
+    {
+        while(avlPop(&trees[q], &key)) trees[0] = insertAVL(trees[0], key);
+    }
+    while(avlPop(&trees[0], &key)) checksum = checksum * 31 + key;
+    printRow("AVL", nowSeconds() - t, 2 * n, checksum);
+}
+
+int main(int argc, char* argv[])
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int m = (argc > 2) ? atoi(argv[2]) : n;
+
+    if(n <= 0 || n > 100000000)
+    {
+        printf("Número de chaves inválido.\n");
+        return 1;
+    }
+
+    int* keys = (int*)malloc(sizeof(int) * n);
+    if(keys == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        return 1;
+    }
+
+    // Chaves distintas e espaçadas de 8 em 8, em ordem aleatória
+    for(int i = 0; i < n; i++) keys[i] = 8 * i + 7;
+    shuffle(keys, n);
+
+    runPushPop(keys, n);
+    runDecreaseKey(keys, n, m);
+    runMeld(keys, n);
+
+    free(keys);
+    return 0;
+}
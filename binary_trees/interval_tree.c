@@ -0,0 +1,203 @@
+#include "interval_tree.h"
+
+// === Node helpers ===
+
+IntervalNode* createIntervalNode(int lo, int hi)
+{
+    IntervalNode* newNode = (IntervalNode*)malloc(sizeof(IntervalNode));
+
+    if(newNode == NULL)
+    {
+        printf("Wasn't possible create a new Node due lacking of memory.");
+        exit(1);
+    }
+
+    newNode->lo = lo;
+    newNode->hi = hi;
+    newNode->maxHigh = hi;
+    newNode->height = 1;
+    newNode->left = NULL;
+    newNode->right = NULL;
+
+    return newNode;
+}
+
+static int intervalHeight(IntervalNode* node)
+{
+    return node ? node->height : 0;
+}
+
+static int intervalBalance(IntervalNode* node)
+{
+    return node ? intervalHeight(node->left) - intervalHeight(node->right) : 0;
+}
+
+// Ordem das chaves: primeiro pelo início, depois pelo fim
+static int compareInterval(int lo, int hi, IntervalNode* node)
+{
+    if(lo != node->lo) return (lo < node->lo) ? -1 : 1;
+    if(hi != node->hi) return (hi < node->hi) ? -1 : 1;
+    return 0;
+}
+
+// Recalcula altura e maior fim da subárvore a partir dos filhos
+static void updateIntervalNode(IntervalNode* node)
+{
+    int hl = intervalHeight(node->left);
+    int hr = intervalHeight(node->right);
+    node->height = 1 + (hl > hr ? hl : hr);
+
+    node->maxHigh = node->hi;
+    if(node->left != NULL && node->left->maxHigh > node->maxHigh) node->maxHigh = node->left->maxHigh;
+    if(node->right != NULL && node->right->maxHigh > node->maxHigh) node->maxHigh = node->right->maxHigh;
+}
+
+// --- Rotations (same shape as rightRotate/leftRotate, also fixing maxHigh) ---
+
+static IntervalNode* intervalRightRotate(IntervalNode* y)
+{
+    IntervalNode* x = y->left;
+    y->left = x->right;
+    x->right = y;
+
+    // y agora é filho de x: atualiza primeiro o de baixo
+    updateIntervalNode(y);
+    updateIntervalNode(x);
+    return x;
+}
+
+static IntervalNode* intervalLeftRotate(IntervalNode* x)
+{
+    IntervalNode* y = x->right;
+    x->right = y->left;
+    y->left = x;
+
+    updateIntervalNode(x);
+    updateIntervalNode(y);
+    return y;
+}
+
+static IntervalNode* rebalanceInterval(IntervalNode* node)
+{
+    updateIntervalNode(node);
+    int balance = intervalBalance(node);
+
+    if(balance > 1)
+    {
+        if(intervalBalance(node->left) < 0)
+            node->left = intervalLeftRotate(node->left);
+        return intervalRightRotate(node);
+    }
+
+    if(balance < -1)
+    {
+        if(intervalBalance(node->right) > 0)
+            node->right = intervalRightRotate(node->right);
+        return intervalLeftRotate(node);
+    }
+
+    return node;
+}
+
+// === Main functions ===
+
+IntervalNode* insertInterval(IntervalNode* node, int lo, int hi)
+{
+    if(node == NULL) return createIntervalNode(lo, hi);
+
+    int cmp = compareInterval(lo, hi, node);
+    if(cmp < 0)
+        node->left = insertInterval(node->left, lo, hi);
+    else if(cmp > 0)
+        node->right = insertInterval(node->right, lo, hi);
+    else
+        return node; // Duplicatas não são permitidas
+
+    return rebalanceInterval(node);
+}
+
+IntervalNode* deleteInterval(IntervalNode* root, int lo, int hi)
+{
+    if(root == NULL) return root;
+
+    int cmp = compareInterval(lo, hi, root);
+    if(cmp < 0)
+    {
+        root->left = deleteInterval(root->left, lo, hi);
+    }
+    else if(cmp > 0)
+    {
+        root->right = deleteInterval(root->right, lo, hi);
+    }
+    else
+    {
+        if(root->left == NULL || root->right == NULL)
+        {
+            IntervalNode* temp = root->left ? root->left : root->right;
+            free(root);
+            return temp;
+        }
+
+        // Dois filhos: copia o sucessor em ordem e o remove da direita
+        IntervalNode* successor = root->right;
+        while(successor->left != NULL) successor = successor->left;
+
+        root->lo = successor->lo;
+        root->hi = successor->hi;
+        root->right = deleteInterval(root->right, successor->lo, successor->hi);
+    }
+
+    return rebalanceInterval(root);
+}
+
+// Percorre em ordem, podando subárvores que não podem ter sobreposição com [a, b]
+static void collectOverlap(IntervalNode* node, int a, int b, IntervalNode* out[], size_t capacity, size_t* count)
+{
+    // Nenhum intervalo desta subárvore termina em a ou depois
+    if(node == NULL || node->maxHigh < a) return;
+
+    collectOverlap(node->left, a, b, out, capacity, count);
+
+    // Este nó e toda a subárvore direita começam depois de b
+    if(node->lo > b) return;
+
+    if(node->hi >= a)
+    {
+        if(*count < capacity) out[*count] = node;
+        (*count)++;
+    }
+
+    collectOverlap(node->right, a, b, out, capacity, count);
+}
+
+size_t queryPoint(IntervalNode* root, int t, IntervalNode* out[], size_t capacity)
+{
+    return queryOverlap(root, t, t, out, capacity);
+}
+
+size_t queryOverlap(IntervalNode* root, int a, int b, IntervalNode* out[], size_t capacity)
+{
+    size_t count = 0;
+    collectOverlap(root, a, b, out, capacity, &count);
+    return count;
+}
+
+void inOrderIntervals(IntervalNode* root)
+{
+    if(root != NULL)
+    {
+        inOrderIntervals(root->left);
+        printf("[%d, %d] ", root->lo, root->hi);
+        inOrderIntervals(root->right);
+    }
+}
+
+void freeIntervalTree(IntervalNode* root)
+{
+    if(root != NULL)
+    {
+        freeIntervalTree(root->left);
+        freeIntervalTree(root->right);
+        free(root);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// AVL node storing a closed interval [lo, hi]. Nodes are ordered by (lo, hi)
+// and each one keeps the largest `hi` of its subtree, which lets the overlap
+// queries skip whole subtrees.
+typedef struct IntervalNode
+{
+    int lo;
+    int hi;
+    int maxHigh; // Largest hi in this subtree
+    int height;
+    struct IntervalNode* left;
+    struct IntervalNode* right;
+} IntervalNode;
+
+/**
+ * @brief Creates a new IntervalNode for [lo, hi].
+ * @param lo The start of the interval.
+ * @param hi The end of the interval (must be >= lo).
+ * @return A pointer to the newly created IntervalNode.
+ */
+IntervalNode* createIntervalNode(int lo, int hi);
+
+/**
+ * @brief Inserts the interval [lo, hi] keeping the tree balanced. Duplicates are ignored.
+ * @param root A pointer to the root of the interval tree.
+ * @param lo The start of the interval.
+ * @param hi The end of the interval (must be >= lo).
+ * @return A pointer to the root of the modified tree.
+ */
+IntervalNode* insertInterval(IntervalNode* root, int lo, int hi);
+
+/**
+ * @brief Deletes the interval [lo, hi] keeping the tree balanced.
+ * @param root A pointer to the root of the interval tree.
+ * @param lo The start of the interval.
+ * @param hi The end of the interval.
+ * @return A pointer to the root of the modified tree.
+ */
+IntervalNode* deleteInterval(IntervalNode* root, int lo, int hi);
+
+/**
+ * @brief Finds every interval that contains the point t (stabbing query).
+ * @param root A pointer to the root of the interval tree.
+ * @param t The point being queried.
+ * @param out Receives up to `capacity` matching nodes, ordered by (lo, hi).
+ * @param capacity The size of `out`.
+ * @return The total number of matches (may be larger than capacity).
+ */
+size_t queryPoint(IntervalNode* root, int t, IntervalNode* out[], size_t capacity);
+
+/**
+ * @brief Finds every interval that overlaps [a, b].
+ * Subtrees whose maxHigh < a or whose start is > b are skipped, so a query with no
+ * match costs O(log n) and one with k matches stays output-sensitive (O(k log n) worst case).
+ * @param root A pointer to the root of the interval tree.
+ * @param a The start of the query interval.
+ * @param b The end of the query interval.
+ * @param out Receives up to `capacity` matching nodes, ordered by (lo, hi).
+ * @param capacity The size of `out`.
+ * @return The total number of matches (may be larger than capacity).
+ */
+size_t queryOverlap(IntervalNode* root, int a, int b, IntervalNode* out[], size_t capacity);
+
+/**
+ * @brief Prints the intervals in order as [lo, hi].
+ * @param root A pointer to the root of the interval tree.
+ */
+void inOrderIntervals(IntervalNode* root);
+
+/**
+ * @brief Frees every node of the interval tree.
+ * @param root A pointer to the root of the interval tree.
+ */
+void freeIntervalTree(IntervalNode* root);
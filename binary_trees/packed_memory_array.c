@@ -0,0 +1,336 @@
+#include <limits.h>
+#include "packed_memory_array.h"
+
+#define PMA_MIN_CAPACITY 16
+#define PMA_MIN_SEGMENT 8
+
+// === Density thresholds ===
+
+// Número de níveis da árvore implícita de janelas (0 = só um segmento)
+static int windowLevels(const PackedArray* pma)
+{
+    int levels = 0;
+    for(size_t segments = pma->capacity / pma->segmentSize; segments > 1; segments >>= 1) levels++;
+    return levels;
+}
+
+// Folhas podem encher até 100%; a janela raiz, até 50%
+static double upperDensity(const PackedArray* pma, int level)
+{
+    int levels = windowLevels(pma);
+    return levels == 0 ? 1.0 : 1.0 - 0.5 * level / levels;
+}
+
+// Folhas podem esvaziar até 12.5%; a janela raiz, até 25%
+static double lowerDensity(const PackedArray* pma, int level)
+{
+    int levels = windowLevels(pma);
+    return levels == 0 ? 0.0 : 0.125 + 0.125 * level / levels;
+}
+
+// === Storage helpers ===
+
+static void allocArrays(PackedArray* pma, size_t capacity)
+{
+    size_t logCapacity = 0;
+    while(((size_t)1 << logCapacity) < capacity) logCapacity++;
+
+    pma->segmentSize = PMA_MIN_SEGMENT;
+    while(pma->segmentSize < logCapacity) pma->segmentSize <<= 1;
+
+    pma->capacity = capacity;
+    pma->values = (int*)malloc(sizeof(int) * capacity);
+    pma->used = (unsigned char*)calloc(capacity, 1);
+    pma->segmentCount = (int*)calloc(capacity / pma->segmentSize, sizeof(int));
+    pma->scratch = (int*)malloc(sizeof(int) * (capacity + 1));
+
+    if(pma->values == NULL || pma->used == NULL || pma->segmentCount == NULL || pma->scratch == NULL)
+    {
+        printf("Wasn't possible grow the packed memory array due lacking of memory.");
+        exit(1);
+    }
+}
+
+static void freeArrays(PackedArray* pma)
+{
+    free(pma->values);
+    free(pma->used);
+    free(pma->segmentCount);
+    free(pma->scratch);
+}
+
+// Valor que as lacunas a partir de `slot` devem repetir
+static int valueBefore(const PackedArray* pma, size_t slot)
+{
+    return slot == 0 ? INT_MIN : pma->values[slot - 1];
+}
+
+// Atualiza as lacunas seguidas que começam em `slot`
+static void fixGapsFrom(PackedArray* pma, size_t slot, int previous)
+{
+    while(slot < pma->capacity && !pma->used[slot])
+    {
+        pma->values[slot++] = previous;
+    }
+}
+
+static size_t windowCount(const PackedArray* pma, size_t start, size_t size)
+{
+    size_t count = 0;
+    for(size_t seg = start / pma->segmentSize; seg < (start + size) / pma->segmentSize; seg++)
+    {
+        count += pma->segmentCount[seg];
+    }
+    return count;
+}
+
+// Copia os elementos da janela para `out`, incluindo `extra` na posição certa se hasExtra
+static size_t gatherWindow(const PackedArray* pma, size_t start, size_t size, int* out, int hasExtra, int extra)
+{
+    size_t m = 0;
+
+    for(size_t slot = start; slot < start + size; slot++)
+    {
+        if(!pma->used[slot]) continue;
+        if(hasExtra && extra < pma->values[slot])
+        {
+            out[m++] = extra;
+            hasExtra = 0;
+        }
+        out[m++] = pma->values[slot];
+    }
+    if(hasExtra) out[m++] = extra;
+
+    return m;
+}
+
+// Espalha m elementos de maneira uniforme pela janela [start, start + size)
+static void spreadWindow(PackedArray* pma, size_t start, size_t size, const int* elements, size_t m)
+{
+    int previous = valueBefore(pma, start);
+    size_t next = 0;
+
+    for(size_t seg = start / pma->segmentSize; seg < (start + size) / pma->segmentSize; seg++)
+    {
+        pma->segmentCount[seg] = 0;
+    }
+
+    for(size_t i = 0; i < size; i++)
+    {
+        size_t slot = start + i;
+
+        if(next < m && i == next * size / m)
+        {
+            previous = elements[next++];
+            pma->values[slot] = previous;
+            pma->used[slot] = 1;
+            pma->segmentCount[slot / pma->segmentSize]++;
+        }
+        else
+        {
+            pma->values[slot] = previous;
+            pma->used[slot] = 0;
+        }
+    }
+
+    fixGapsFrom(pma, start + size, previous);
+}
+
+// Realoca com outra capacidade e redistribui tudo (mais `extra`, se hasExtra)
+static void resize(PackedArray* pma, size_t capacity, int hasExtra, int extra)
+{
+    int* elements = (int*)malloc(sizeof(int) * (pma->count + 1));
+    if(elements == NULL)
+    {
+        printf("Wasn't possible resize the packed memory array due lacking of memory.");
+        exit(1);
+    }
+
+    size_t m = gatherWindow(pma, 0, pma->capacity, elements, hasExtra, extra);
+
+    freeArrays(pma);
+    allocArrays(pma, capacity);
+    spreadWindow(pma, 0, capacity, elements, m);
+
+    free(elements);
+}
+
+// Primeiro slot ocupado com valor >= data (ou capacity)
+static size_t lowerBoundSlot(const PackedArray* pma, int data)
+{
+    size_t lo = 0;
+    size_t hi = pma->capacity;
+
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(pma->values[mid] < data)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Só as lacunas iniciais (INT_MIN) podem aparecer antes do elemento
+    while(lo < pma->capacity && !pma->used[lo]) lo++;
+    return lo;
+}
+
+// === Public functions ===
+
+void pmaInit(PackedArray* pma)
+{
+    allocArrays(pma, PMA_MIN_CAPACITY);
+    pma->count = 0;
+    fixGapsFrom(pma, 0, INT_MIN);
+}
+
+int pmaInsert(PackedArray* pma, int data)
+{
+    size_t pos = lowerBoundSlot(pma, data);
+    if(pos < pma->capacity && pma->values[pos] == data) return 0;
+
+    // Sobe pelas janelas até achar uma com espaço dentro do limite de densidade
+    size_t seg = (pos < pma->capacity ? pos : pma->capacity - 1) / pma->segmentSize;
+    size_t windowSegments = 1;
+    int levels = windowLevels(pma);
+    int level = 0;
+
+    while(1)
+    {
+        size_t size = windowSegments * pma->segmentSize;
+        size_t start = (seg - seg % windowSegments) * pma->segmentSize;
+        size_t count = windowCount(pma, start, size);
+
+        if(count + 1 <= upperDensity(pma, level) * size)
+        {
+            size_t m = gatherWindow(pma, start, size, pma->scratch, 1, data);
+            spreadWindow(pma, start, size, pma->scratch, m);
+            break;
+        }
+
+        if(level == levels)
+        {
+            // Nem a raiz comporta: dobra a capacidade
+            resize(pma, pma->capacity * 2, 1, data);
+            break;
+        }
+
+        level++;
+        windowSegments *= 2;
+    }
+
+    pma->count++;
+    return 1;
+}
+
+int pmaDelete(PackedArray* pma, int data)
+{
+    size_t slot = lowerBoundSlot(pma, data);
+    if(slot == pma->capacity || pma->values[slot] != data) return 0;
+
+    pma->used[slot] = 0;
+    pma->segmentCount[slot / pma->segmentSize]--;
+    pma->count--;
+    fixGapsFrom(pma, slot, valueBefore(pma, slot));
+
+    int levels = windowLevels(pma);
+    if(pma->capacity > PMA_MIN_CAPACITY && pma->count < lowerDensity(pma, levels) * pma->capacity)
+    {
+        // Raiz esparsa demais: reduz a capacidade pela metade
+        resize(pma, pma->capacity / 2, 0, 0);
+        return 1;
+    }
+
+    // Sobe até uma janela que respeite a densidade mínima e a redistribui
+    size_t seg = slot / pma->segmentSize;
+    size_t windowSegments = 1;
+    int level = 0;
+
+    while(level < levels)
+    {
+        size_t size = windowSegments * pma->segmentSize;
+        size_t start = (seg - seg % windowSegments) * pma->segmentSize;
+        if(windowCount(pma, start, size) >= lowerDensity(pma, level) * size) break;
+
+        level++;
+        windowSegments *= 2;
+    }
+
+    if(level > 0)
+    {
+        size_t size = windowSegments * pma->segmentSize;
+        size_t start = (seg - seg % windowSegments) * pma->segmentSize;
+        size_t m = gatherWindow(pma, start, size, pma->scratch, 0, 0);
+        spreadWindow(pma, start, size, pma->scratch, m);
+    }
+
+    return 1;
+}
+
+int pmaSearch(const PackedArray* pma, int data)
+{
+    size_t slot = lowerBoundSlot(pma, data);
+    return slot < pma->capacity && pma->values[slot] == data;
+}
+
+int pmaFindMin(const PackedArray* pma, int* out)
+{
+    for(size_t slot = 0; slot < pma->capacity; slot++)
+    {
+        if(pma->used[slot])
+        {
+            *out = pma->values[slot];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int pmaFindMax(const PackedArray* pma, int* out)
+{
+    for(size_t slot = pma->capacity; slot > 0; slot--)
+    {
+        if(pma->used[slot - 1])
+        {
+            *out = pma->values[slot - 1];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+size_t pmaScan(const PackedArray* pma, int lo, int hi, int out[], size_t capacity)
+{
+    size_t count = 0;
+
+    // Leitura sequencial: o prefetcher de hardware acompanha sozinho
+    for(size_t slot = lowerBoundSlot(pma, lo); slot < pma->capacity; slot++)
+    {
+        if(!pma->used[slot]) continue;
+        if(pma->values[slot] > hi) break;
+
+        if(count < capacity) out[count] = pma->values[slot];
+        count++;
+    }
+
+    return count;
+}
+
+void pmaInOrderTraversal(const PackedArray* pma)
+{
+    for(size_t slot = 0; slot < pma->capacity; slot++)
+    {
+        if(pma->used[slot]) printf("%d ", pma->values[slot]);
+    }
+}
+
+void pmaFree(PackedArray* pma)
+{
+    freeArrays(pma);
+    pma->values = NULL;
+    pma->used = NULL;
+    pma->segmentCount = NULL;
+    pma->scratch = NULL;
+    pma->capacity = 0;
+    pma->count = 0;
+}
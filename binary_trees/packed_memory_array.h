@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// Ordered set of ints stored in a sorted array with gaps (packed memory array).
+// The array is split into segments of ~log2(capacity) slots; an insert or
+// delete only rewrites the smallest window of segments whose density stays
+// inside its thresholds, so updates cost O(log^2 n) amortized and ordered
+// scans are plain sequential reads.
+//
+// Gaps repeat the value of the closest element to their left (INT_MIN if
+// there is none), which keeps `values` sorted for binary search.
+typedef struct
+{
+    int* values;
+    unsigned char* used;  // 1 if the slot holds an element, 0 if it is a gap
+    int* segmentCount;    // Elements per segment
+    int* scratch;         // capacity + 1 ints used while redistributing
+    size_t capacity;      // Power of two
+    size_t segmentSize;   // Power of two, divides capacity
+    size_t count;
+} PackedArray;
+
+/**
+ * @brief Initializes an empty packed memory array.
+ * @param pma A pointer to the structure to be initialized.
+ */
+void pmaInit(PackedArray* pma);
+
+/**
+ * @brief Inserts a key keeping the array sorted. Duplicates are ignored.
+ * @param pma A pointer to the packed memory array.
+ * @param data The key to be inserted.
+ * @return 1 if the key was inserted, 0 if it was already present.
+ */
+int pmaInsert(PackedArray* pma, int data);
+
+/**
+ * @brief Deletes a key.
+ * @param pma A pointer to the packed memory array.
+ * @param data The key to be deleted.
+ * @return 1 if the key was deleted, 0 if it was not present.
+ */
+int pmaDelete(PackedArray* pma, int data);
+
+/**
+ * @brief Searches for a key with a binary search over the slots.
+ * @param pma A pointer to the packed memory array.
+ * @param data The key to be searched for.
+ * @return 1 if the key is present, 0 otherwise.
+ */
+int pmaSearch(const PackedArray* pma, int data);
+
+/**
+ * @brief Finds the smallest key.
+ * @param pma A pointer to the packed memory array.
+ * @param out Receives the minimum when the array is not empty.
+ * @return 1 if the array is not empty, 0 otherwise.
+ */
+int pmaFindMin(const PackedArray* pma, int* out);
+
+/**
+ * @brief Finds the largest key.
+ * @param pma A pointer to the packed memory array.
+ * @param out Receives the maximum when the array is not empty.
+ * @return 1 if the array is not empty, 0 otherwise.
+ */
+int pmaFindMax(const PackedArray* pma, int* out);
+
+/**
+ * @brief Copies the keys in [lo, hi], in order, with one sequential pass.
+ * @param pma A pointer to the packed memory array.
+ * @param lo The lower bound (inclusive).
+ * @param hi The upper bound (inclusive).
+ * @param out Receives up to `capacity` keys.
+ * @param capacity The size of `out`.
+ * @return The total number of keys in [lo, hi] (may be larger than capacity).
+ */
+size_t pmaScan(const PackedArray* pma, int lo, int hi, int out[], size_t capacity);
+
+/**
+ * @brief Prints every key in order.
+ * @param pma A pointer to the packed memory array.
+ */
+void pmaInOrderTraversal(const PackedArray* pma);
+
+/**
+ * @brief Frees the packed memory array.
+ * @param pma A pointer to the packed memory array.
+ * @note Call pmaInit again before reusing the structure.
+ */
+void pmaFree(PackedArray* pma);
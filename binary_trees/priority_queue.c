@@ -0,0 +1,316 @@
+#include "priority_queue.h"
+
+#define DHEAP_MIN_CAPACITY 16
+
+static void* reallocOrDie(void* memory, size_t bytes)
+{
+    memory = realloc(memory, bytes);
+
+    if(memory == NULL)
+    {
+        printf("Wasn't possible grow the priority queue due lacking of memory.");
+        exit(1);
+    }
+
+    return memory;
+}
+
+/*
+   ============================================================
+   === HEAP D-ÁRIO ===
+   ============================================================
+*/
+
+// Coloca o par (key, handle) na posição pos e atualiza o índice
+static void placeAt(DaryHeap* heap, int pos, int key, int handle)
+{
+    heap->keys[pos] = key;
+    heap->handleAt[pos] = handle;
+    heap->position[handle] = pos;
+}
+
+// Sobe o elemento de pos enquanto for menor que o pai (move "buracos", sem trocas)
+static void siftUp(DaryHeap* heap, int pos)
+{
+    int key = heap->keys[pos];
+    int handle = heap->handleAt[pos];
+
+    while(pos > 0)
+    {
+        int parent = (pos - 1) / heap->arity;
+        if(heap->keys[parent] <= key) break;
+
+        placeAt(heap, pos, heap->keys[parent], heap->handleAt[parent]);
+        pos = parent;
+    }
+
+    placeAt(heap, pos, key, handle);
+}
+
+// Desce o elemento de pos trocando com o menor dos d filhos
+static void siftDown(DaryHeap* heap, int pos)
+{
+    int key = heap->keys[pos];
+    int handle = heap->handleAt[pos];
+
+    while(1)
+    {
+        int first = pos * heap->arity + 1;
+        if(first >= heap->size) break;
+
+        int last = first + heap->arity;
+        if(last > heap->size) last = heap->size;
+
+        int smallest = first;
+        for(int child = first + 1; child < last; child++)
+        {
+            if(heap->keys[child] < heap->keys[smallest]) smallest = child;
+        }
+
+        if(heap->keys[smallest] >= key) break;
+
+        placeAt(heap, pos, heap->keys[smallest], heap->handleAt[smallest]);
+        pos = smallest;
+    }
+
+    placeAt(heap, pos, key, handle);
+}
+
+void dheapInit(DaryHeap* heap, int arity)
+{
+    heap->arity = arity < 2 ? 2 : arity;
+    heap->capacity = DHEAP_MIN_CAPACITY;
+    heap->size = 0;
+    heap->handleCount = 0;
+    heap->freeCount = 0;
+    heap->keys = (int*)reallocOrDie(NULL, sizeof(int) * heap->capacity);
+    heap->handleAt = (int*)reallocOrDie(NULL, sizeof(int) * heap->capacity);
+    heap->position = (int*)reallocOrDie(NULL, sizeof(int) * heap->capacity);
+    heap->freeHandles = (int*)reallocOrDie(NULL, sizeof(int) * heap->capacity);
+}
+
+int dheapPush(DaryHeap* heap, int key)
+{
+    if(heap->size == heap->capacity)
+    {
+        heap->capacity *= 2;
+        heap->keys = (int*)reallocOrDie(heap->keys, sizeof(int) * heap->capacity);
+        heap->handleAt = (int*)reallocOrDie(heap->handleAt, sizeof(int) * heap->capacity);
+        heap->position = (int*)reallocOrDie(heap->position, sizeof(int) * heap->capacity);
+        heap->freeHandles = (int*)reallocOrDie(heap->freeHandles, sizeof(int) * heap->capacity);
+    }
+
+    // Reaproveita um handle liberado; nunca há mais handles vivos que capacity
+    int handle = (heap->freeCount > 0) ? heap->freeHandles[--heap->freeCount] : heap->handleCount++;
+
+    placeAt(heap, heap->size, key, handle);
+    heap->size++;
+    siftUp(heap, heap->size - 1);
+
+    return handle;
+}
+
+int dheapTop(const DaryHeap* heap, int* key)
+{
+    if(heap->size == 0) return -1;
+
+    *key = heap->keys[0];
+    return heap->handleAt[0];
+}
+
+int dheapPop(DaryHeap* heap, int* key)
+{
+    if(heap->size == 0) return 0;
+
+    *key = heap->keys[0];
+    int handle = heap->handleAt[0];
+    heap->position[handle] = -1;
+    heap->freeHandles[heap->freeCount++] = handle;
+
+    heap->size--;
+    if(heap->size > 0)
+    {
+        placeAt(heap, 0, heap->keys[heap->size], heap->handleAt[heap->size]);
+        siftDown(heap, 0);
+    }
+
+    return 1;
+}
+
+int dheapDecreaseKey(DaryHeap* heap, int handle, int key)
+{
+    if(handle < 0 || handle >= heap->handleCount) return 0;
+
+    int pos = heap->position[handle];
+    if(pos < 0 || key > heap->keys[pos]) return 0;
+
+    heap->keys[pos] = key;
+    siftUp(heap, pos);
+    return 1;
+}
+
+void dheapFree(DaryHeap* heap)
+{
+    free(heap->keys);
+    free(heap->handleAt);
+    free(heap->position);
+    free(heap->freeHandles);
+    heap->keys = heap->handleAt = heap->position = heap->freeHandles = NULL;
+    heap->size = heap->capacity = 0;
+}
+
+/*
+   ============================================================
+   === PAIRING HEAP ===
+   ============================================================
+*/
+
+// Junta duas árvores: a de maior raiz vira o primeiro filho da outra
+static PairingNode* link(PairingNode* a, PairingNode* b)
+{
+    if(a == NULL) return b;
+    if(b == NULL) return a;
+
+    if(b->key < a->key)
+    {
+        PairingNode* temp = a;
+        a = b;
+        b = temp;
+    }
+
+    b->prev = a;
+    b->sibling = a->child;
+    if(a->child != NULL) a->child->prev = b;
+    a->child = b;
+
+    a->sibling = NULL;
+    a->prev = NULL;
+    return a;
+}
+
+// Two-pass: junta os irmãos em pares da esquerda para a direita e depois
+// acumula da direita para a esquerda (iterativo, sem recursão)
+static PairingNode* mergePairs(PairingNode* first)
+{
+    PairingNode* pairs = NULL; // Pilha de pares, encadeada por sibling
+
+    while(first != NULL)
+    {
+        PairingNode* a = first;
+        PairingNode* b = a->sibling;
+        first = b ? b->sibling : NULL;
+
+        a->sibling = a->prev = NULL;
+        if(b != NULL) b->sibling = b->prev = NULL;
+
+        PairingNode* merged = link(a, b);
+        merged->sibling = pairs;
+        pairs = merged;
+    }
+
+    PairingNode* result = NULL;
+    while(pairs != NULL)
+    {
+        PairingNode* next = pairs->sibling;
+        pairs->sibling = NULL;
+        result = link(result, pairs);
+        pairs = next;
+    }
+
+    return result;
+}
+
+void pairingInit(PairingHeap* heap)
+{
+    heap->root = NULL;
+    heap->size = 0;
+}
+
+PairingNode* pairingPush(PairingHeap* heap, int key)
+{
+    PairingNode* node = (PairingNode*)malloc(sizeof(PairingNode));
+
+    if(node == NULL)
+    {
+        printf("Wasn't possible create a new Node due lacking of memory.");
+        exit(1);
+    }
+
+    node->key = key;
+    node->child = node->sibling = node->prev = NULL;
+
+    heap->root = link(heap->root, node);
+    heap->size++;
+    return node;
+}
+
+int pairingTop(const PairingHeap* heap, int* key)
+{
+    if(heap->root == NULL) return 0;
+
+    *key = heap->root->key;
+    return 1;
+}
+
+int pairingPop(PairingHeap* heap, int* key)
+{
+    if(heap->root == NULL) return 0;
+
+    PairingNode* old = heap->root;
+    *key = old->key;
+
+    heap->root = mergePairs(old->child);
+    heap->size--;
+    free(old);
+    return 1;
+}
+
+void pairingDecreaseKey(PairingHeap* heap, PairingNode* node, int key)
+{
+    if(key > node->key) return;
+
+    node->key = key;
+    if(node == heap->root) return;
+
+    // Desliga a subárvore do nó da lista de irmãos e junta com a raiz
+    if(node->prev->child == node)
+        node->prev->child = node->sibling;
+    else
+        node->prev->sibling = node->sibling;
+
+    if(node->sibling != NULL) node->sibling->prev = node->prev;
+    node->sibling = node->prev = NULL;
+
+    heap->root = link(heap->root, node);
+}
+
+void pairingMeld(PairingHeap* into, PairingHeap* from)
+{
+    into->root = link(into->root, from->root);
+    into->size += from->size;
+    pairingInit(from);
+}
+
+void pairingFree(PairingHeap* heap)
+{
+    // Achata a árvore iterativamente: filhos vão para a lista de irmãos
+    PairingNode* pending = heap->root;
+
+    while(pending != NULL)
+    {
+        PairingNode* node = pending;
+        pending = node->sibling;
+
+        if(node->child != NULL)
+        {
+            PairingNode* child = node->child;
+            while(child->sibling != NULL) child = child->sibling;
+            child->sibling = pending;
+            pending = node->child;
+        }
+
+        free(node);
+    }
+
+    pairingInit(heap);
+}
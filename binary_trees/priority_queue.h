@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// === d-ary heap ===
+
+// Array-backed min-heap with d children per node. Every pushed key receives a
+// handle (a small int) that stays valid until the key is popped, so its
+// priority can be lowered with dheapDecreaseKey.
+typedef struct
+{
+    int* keys;        // keys[pos]
+    int* handleAt;    // handleAt[pos] = handle of the key at pos
+    int* position;    // position[handle] = pos, or -1 if the handle is free
+    int* freeHandles; // Stack of released handles
+    int freeCount;
+    int handleCount;  // Handles created so far
+    int size;
+    int capacity;
+    int arity;
+} DaryHeap;
+
+/**
+ * @brief Initializes an empty d-ary heap.
+ * @param heap A pointer to the structure to be initialized.
+ * @param arity The number of children per node (2 = binary heap; 4 is usually fastest).
+ */
+void dheapInit(DaryHeap* heap, int arity);
+
+/**
+ * @brief Inserts a key in O(log_d n).
+ * @param heap A pointer to the heap.
+ * @param key The key to be inserted.
+ * @return The handle of the new key.
+ */
+int dheapPush(DaryHeap* heap, int key);
+
+/**
+ * @brief Reads the smallest key in O(1).
+ * @param heap A pointer to the heap.
+ * @param key Receives the smallest key.
+ * @return The handle of the smallest key, or -1 if the heap is empty.
+ */
+int dheapTop(const DaryHeap* heap, int* key);
+
+/**
+ * @brief Removes the smallest key in O(d log_d n). Its handle becomes free.
+ * @param heap A pointer to the heap.
+ * @param key Receives the removed key.
+ * @return 1 if a key was removed, 0 if the heap is empty.
+ */
+int dheapPop(DaryHeap* heap, int* key);
+
+/**
+ * @brief Lowers the key of a handle in O(log_d n).
+ * @param heap A pointer to the heap.
+ * @param handle The handle returned by dheapPush.
+ * @param key The new key (must not be larger than the current one).
+ * @return 1 on success, 0 if the handle is not in the heap or the key would grow.
+ */
+int dheapDecreaseKey(DaryHeap* heap, int handle, int key);
+
+/**
+ * @brief Frees the heap arrays.
+ * @param heap A pointer to the heap.
+ * @note Call dheapInit again before reusing the structure.
+ */
+void dheapFree(DaryHeap* heap);
+
+// === Pairing heap ===
+
+typedef struct PairingNode
+{
+    int key;
+    struct PairingNode* child;   // First child
+    struct PairingNode* sibling; // Next sibling
+    struct PairingNode* prev;    // Parent for a first child, previous sibling otherwise
+} PairingNode;
+
+// Pointer-based min-heap with O(1) push and meld and O(log n) amortized pop.
+// The node returned by pairingPush is the handle used by pairingDecreaseKey.
+typedef struct
+{
+    PairingNode* root;
+    size_t size;
+} PairingHeap;
+
+/**
+ * @brief Initializes an empty pairing heap.
+ * @param heap A pointer to the structure to be initialized.
+ */
+void pairingInit(PairingHeap* heap);
+
+/**
+ * @brief Inserts a key in O(1).
+ * @param heap A pointer to the heap.
+ * @param key The key to be inserted.
+ * @return The node holding the key (valid until it is popped).
+ */
+PairingNode* pairingPush(PairingHeap* heap, int key);
+
+/**
+ * @brief Reads the smallest key in O(1).
+ * @param heap A pointer to the heap.
+ * @param key Receives the smallest key.
+ * @return 1 if the heap is not empty, 0 otherwise.
+ */
+int pairingTop(const PairingHeap* heap, int* key);
+
+/**
+ * @brief Removes the smallest key (two-pass pairing) in O(log n) amortized.
+ * @param heap A pointer to the heap.
+ * @param key Receives the removed key.
+ * @return 1 if a key was removed, 0 if the heap is empty.
+ */
+int pairingPop(PairingHeap* heap, int* key);
+
+/**
+ * @brief Lowers the key of a node.
+ * @param heap A pointer to the heap.
+ * @param node The node returned by pairingPush.
+ * @param key The new key (ignored if larger than the current one).
+ */
+void pairingDecreaseKey(PairingHeap* heap, PairingNode* node, int key);
+
+/**
+ * @brief Moves every key of `from` into `into` in O(1). `from` is left empty.
+ * @param into A pointer to the heap that receives the keys.
+ * @param from A pointer to the heap whose keys are moved.
+ */
+void pairingMeld(PairingHeap* into, PairingHeap* from);
+
+/**
+ * @brief Frees every node of the pairing heap.
+ * @param heap A pointer to the heap.
+ */
+void pairingFree(PairingHeap* heap);
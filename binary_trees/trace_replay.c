@@ -0,0 +1,305 @@
+/*
+Reexecuta um trace gravado (tree_trace.h) contra as implementações de árvore
+do diretório e compara vazão e latência.
+
+Para cada implementação o trace roda duas vezes numa estrutura nova:
+  1. sem cronômetro por operação, para medir a vazão real;
+  2. cronometrando cada operação, para os percentis de latência.
+Os resultados das buscas e contagens são somados num checksum, que precisa
+ser igual em todas as implementações.
+
+Gravar:   ./tree_problem --record carga.trace --batch comandos.txt
+Compilar: gcc -O2 trace_replay.c tree_trace.c tree_template.c tree_hash.c tree_bloom.c \
+              tree_lazy.c packed_memory_array.c veb_set.c compressed_set.c -o trace_replay
+Uso:      ./trace_replay <trace> [bst|avl|hash|bloom|lazy|pma|veb|cset ...]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <limits.h>
+#include "tree_trace.h"
+#include "tree_template.h"
+#include "tree_hash.h"
+#include "tree_bloom.h"
+#include "tree_lazy.h"
+#include "packed_memory_array.h"
+#include "veb_set.h"
+#include "compressed_set.h"
+
+// Tamanho inicial esperado do filtro de Bloom (ele cresce sozinho)
+#define REPLAY_BLOOM_KEYS 4096
+
+static unsigned long long nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+// Interface comum: cada implementação é adaptada para essas cinco operações
+typedef struct
+{
+    const char* name;
+    void* (*create)(void);
+    void (*insert)(void* tree, int key);
+    int (*search)(void* tree, int key);
+    void (*remove)(void* tree, int key);
+    size_t (*range)(void* tree, int lo, int hi);
+    void (*destroy)(void* tree);
+} TreeAdapter;
+
+static void* allocOrDie(size_t bytes)
+{
+    void* memory = malloc(bytes);
+
+    if(memory == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        exit(1);
+    }
+
+    return memory;
+}
+
+// Conta as chaves em [lo, hi] de uma árvore do tree_template sem recursão
+static size_t countNodeRange(Node* root, int lo, int hi)
+{
+    size_t count = 0;
+
+    for(Node* node = findCeiling(root, lo); node != NULL && node->data <= hi; )
+    {
+        count++;
+        if(node->data == INT_MAX) break;
+        node = findSuccessor(root, node->data);
+    }
+
+    return count;
+}
+
+// === BST (insert / deleteNode) ===
+
+static void* bstCreate(void)                       { Node** root = allocOrDie(sizeof(Node*)); *root = NULL; return root; }
+static void bstInsert(void* tree, int key)         { *(Node**)tree = insert(*(Node**)tree, key); }
+static int bstSearch(void* tree, int key)          { return search(*(Node**)tree, key) != NULL; }
+static void bstRemove(void* tree, int key)         { *(Node**)tree = deleteNode(*(Node**)tree, key); }
+static size_t bstRange(void* tree, int lo, int hi) { return countNodeRange(*(Node**)tree, lo, hi); }
+static void bstDestroy(void* tree)                 { freeTree(*(Node**)tree); free(tree); }
+
+// === AVL (insertAVL / deleteNodeAVL) ===
+
+static void avlInsert(void* tree, int key)         { *(Node**)tree = insertAVL(*(Node**)tree, key); }
+static void avlRemove(void* tree, int key)         { *(Node**)tree = deleteNodeAVL(*(Node**)tree, key); }
+
+// === AVL + índice hash ===
+
+static void* hashCreate(void)                      { HashedTree* t = allocOrDie(sizeof(HashedTree)); hashedTreeInit(t); return t; }
+static void hashInsert(void* tree, int key)        { hashedTreeInsert((HashedTree*)tree, key); }
+static int hashSearch(void* tree, int key)         { return hashedTreeContains((HashedTree*)tree, key); }
+static void hashRemove(void* tree, int key)        { hashedTreeDelete((HashedTree*)tree, key); }
+static size_t hashRange(void* tree, int lo, int hi){ return countNodeRange(((HashedTree*)tree)->root, lo, hi); }
+static void hashDestroy(void* tree)                { hashedTreeFree((HashedTree*)tree); free(tree); }
+
+// === AVL + filtro de Bloom ===
+
+static void* bloomCreate(void)                     { BloomTree* t = allocOrDie(sizeof(BloomTree)); bloomTreeInit(t, REPLAY_BLOOM_KEYS); return t; }
+static void bloomInsert(void* tree, int key)       { bloomTreeInsert((BloomTree*)tree, key); }
+static int bloomSearch(void* tree, int key)        { return bloomTreeSearch((BloomTree*)tree, key) != NULL; }
+static void bloomRemove(void* tree, int key)       { bloomTreeDelete((BloomTree*)tree, key); }
+static size_t bloomRange(void* tree, int lo, int hi){ return countNodeRange(((BloomTree*)tree)->root, lo, hi); }
+static void bloomDestroy(void* tree)               { bloomTreeFree((BloomTree*)tree); free(tree); }
+
+// === AVL com remoção preguiçosa ===
+
+// A árvore é balanceada, então a recursão tem profundidade O(log n)
+static size_t countLazyRange(LazyNode* node, int lo, int hi)
+{
+    if(node == NULL) return 0;
+    if(node->data < lo) return countLazyRange(node->right, lo, hi);
+    if(node->data > hi) return countLazyRange(node->left, lo, hi);
+
+    return !node->deleted + countLazyRange(node->left, lo, hi) + countLazyRange(node->right, lo, hi);
+}
+
+static void* lazyCreate(void)                      { LazyNode** root = allocOrDie(sizeof(LazyNode*)); *root = NULL; return root; }
+static void lazyInsertKey(void* tree, int key)     { *(LazyNode**)tree = lazyInsert(*(LazyNode**)tree, key); }
+static int lazySearchKey(void* tree, int key)      { return lazySearch(*(LazyNode**)tree, key) != NULL; }
+static void lazyRemove(void* tree, int key)        { *(LazyNode**)tree = lazyDelete(*(LazyNode**)tree, key, LAZY_DEFAULT_GARBAGE_RATIO); }
+static size_t lazyRange(void* tree, int lo, int hi){ return countLazyRange(*(LazyNode**)tree, lo, hi); }
+static void lazyDestroy(void* tree)                { freeLazyTree(*(LazyNode**)tree); free(tree); }
+
+// === Packed memory array ===
+
+static void* pmaCreate(void)                       { PackedArray* p = allocOrDie(sizeof(PackedArray)); pmaInit(p); return p; }
+static void pmaInsertKey(void* tree, int key)      { pmaInsert((PackedArray*)tree, key); }
+static int pmaSearchKey(void* tree, int key)       { return pmaSearch((PackedArray*)tree, key); }
+static void pmaRemove(void* tree, int key)         { pmaDelete((PackedArray*)tree, key); }
+static size_t pmaRange(void* tree, int lo, int hi) { return pmaScan((PackedArray*)tree, lo, hi, NULL, 0); }
+static void pmaDestroy(void* tree)                 { pmaFree((PackedArray*)tree); free(tree); }
+
+// === van Emde Boas ===
+
+static size_t vebRange(void* tree, int lo, int hi)
+{
+    const VebSet* set = (const VebSet*)tree;
+    size_t count = vebMember(set, lo);
+    int key = lo;
+
+    while(key < hi && vebSuccessor(set, key, &key) && key <= hi) count++;
+    return count;
+}
+
+static void* vebCreate(void)                       { VebSet* v = allocOrDie(sizeof(VebSet)); vebInit(v); return v; }
+static void vebInsertKey(void* tree, int key)      { vebInsert((VebSet*)tree, key); }
+static int vebSearchKey(void* tree, int key)       { return vebMember((VebSet*)tree, key); }
+static void vebRemove(void* tree, int key)         { vebDelete((VebSet*)tree, key); }
+static void vebDestroy(void* tree)                 { vebFree((VebSet*)tree); free(tree); }
+
+// === Conjunto comprimido ===
+
+static size_t csetRange(void* tree, int lo, int hi)
+{
+    const CompressedSet* set = (const CompressedSet*)tree;
+
+    // rank(hi) conta as chaves < hi; hi entra à parte para aceitar INT_MAX
+    return csetRank(set, hi) + csetContains(set, hi) - csetRank(set, lo);
+}
+
+static void* csetCreate(void)                      { CompressedSet* c = allocOrDie(sizeof(CompressedSet)); csetInit(c); return c; }
+static void csetInsertKey(void* tree, int key)     { csetInsert((CompressedSet*)tree, key); }
+static int csetSearchKey(void* tree, int key)      { return csetContains((CompressedSet*)tree, key); }
+static void csetRemove(void* tree, int key)        { csetDelete((CompressedSet*)tree, key); }
+static void csetDestroy(void* tree)                { csetFree((CompressedSet*)tree); free(tree); }
+
+static const TreeAdapter adapters[] = {
+    { "bst",   bstCreate,   bstInsert,      bstSearch,     bstRemove,   bstRange,   bstDestroy   },
+    { "avl",   bstCreate,   avlInsert,      bstSearch,     avlRemove,   bstRange,   bstDestroy   },
+    { "hash",  hashCreate,  hashInsert,     hashSearch,    hashRemove,  hashRange,  hashDestroy  },
+    { "bloom", bloomCreate, bloomInsert,    bloomSearch,   bloomRemove, bloomRange, bloomDestroy },
+    { "lazy",  lazyCreate,  lazyInsertKey,  lazySearchKey, lazyRemove,  lazyRange,  lazyDestroy  },
+    { "pma",   pmaCreate,   pmaInsertKey,   pmaSearchKey,  pmaRemove,   pmaRange,   pmaDestroy   },
+    { "veb",   vebCreate,   vebInsertKey,   vebSearchKey,  vebRemove,   vebRange,   vebDestroy   },
+    { "cset",  csetCreate,  csetInsertKey,  csetSearchKey, csetRemove,  csetRange,  csetDestroy  },
+};
+
+#define ADAPTER_COUNT (sizeof(adapters) / sizeof(adapters[0]))
+
+// === Replay ===
+
+static unsigned long long runRecord(const TreeAdapter* adapter, void* tree, const TraceRecord* record)
+{
+    switch(record->op)
+    {
+        case TRACE_INSERT:
+            adapter->insert(tree, record->a);
+            return 0;
+        case TRACE_SEARCH:
+            return (unsigned long long)adapter->search(tree, record->a);
+        case TRACE_DELETE:
+            adapter->remove(tree, record->a);
+            return 0;
+        case TRACE_RANGE:
+            return (unsigned long long)adapter->range(tree, record->a, record->b);
+    }
+    return 0;
+}
+
+static int compareLatency(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a;
+    unsigned long long y = *(const unsigned long long*)b;
+    return (x > y) - (x < y);
+}
+
+static unsigned long long percentile(const unsigned long long* sorted, size_t count, double fraction)
+{
+    size_t index = (size_t)(fraction * (count - 1) + 0.5);
+    return sorted[index];
+}
+
+static void replay(const TreeAdapter* adapter, const TraceRecord* records, size_t count, unsigned long long* latency)
+{
+    unsigned long long checksum = 0;
+
+    // Passada 1: vazão, sem cronômetro por operação
+    void* tree = adapter->create();
+    unsigned long long start = nowNs();
+    for(size_t i = 0; i < count; i++) checksum += runRecord(adapter, tree, &records[i]);
+    unsigned long long elapsed = nowNs() - start;
+    adapter->destroy(tree);
+
+    // Passada 2: latência de cada operação
+    tree = adapter->create();
+    for(size_t i = 0; i < count; i++)
+    {
+        unsigned long long before = nowNs();
+        runRecord(adapter, tree, &records[i]);
+        latency[i] = nowNs() - before;
+    }
+    adapter->destroy(tree);
+
+    qsort(latency, count, sizeof(unsigned long long), compareLatency);
+
+    printf("%-6s %12.0f %8llu %8llu %8llu %8llu %10llu   %016llx\n", adapter->name,
+           elapsed > 0 ? count / (elapsed / 1e9) : 0.0,
+           percentile(latency, count, 0.50), percentile(latency, count, 0.90),
+           percentile(latency, count, 0.99), percentile(latency, count, 0.999),
+           latency[count - 1], checksum);
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+    {
+        printf("Uso: %s <trace> [bst|avl|hash|bloom|lazy|pma|veb|cset ...]\n", argv[0]);
+        return 1;
+    }
+
+    size_t count;
+    TraceRecord* records = traceLoad(argv[1], &count);
+    if(records == NULL)
+    {
+        printf("Não foi possível ler o trace %s (arquivo ausente ou corrompido).\n", argv[1]);
+        return 1;
+    }
+    if(count == 0)
+    {
+        printf("O trace está vazio.\n");
+        free(records);
+        return 0;
+    }
+
+    size_t perOp[TRACE_RANGE + 1] = { 0 };
+    for(size_t i = 0; i < count; i++) perOp[records[i].op]++;
+    printf("%zu operações: %zu insert, %zu search, %zu delete, %zu range\n\n", count,
+           perOp[TRACE_INSERT], perOp[TRACE_SEARCH], perOp[TRACE_DELETE], perOp[TRACE_RANGE]);
+
+    unsigned long long* latency = (unsigned long long*)allocOrDie(sizeof(unsigned long long) * count);
+
+    printf("%-6s %12s %8s %8s %8s %8s %10s   %s\n", "impl", "ops/s", "p50 ns", "p90 ns", "p99 ns",
+           "p999 ns", "max ns", "checksum");
+
+    if(argc == 2)
+    {
+        for(size_t a = 0; a < ADAPTER_COUNT; a++) replay(&adapters[a], records, count, latency);
+    }
+
+    for(int arg = 2; arg < argc; arg++)
+    {
+        size_t a = 0;
+        while(a < ADAPTER_COUNT && strcmp(argv[arg], adapters[a].name) != 0) a++;
+
+        if(a == ADAPTER_COUNT)
+        {
+            printf("Implementação desconhecida: %s\n", argv[arg]);
+            continue;
+        }
+
+        replay(&adapters[a], records, count, latency);
+    }
+
+    free(latency);
+    free(records);
+    return 0;
+}
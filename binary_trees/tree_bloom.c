@@ -0,0 +1,153 @@
+#include <string.h>
+#include "tree_bloom.h"
+
+// Contador saturado: não é mais decrementado (só um rebuild o zera)
+#define BLOOM_COUNTER_MAX 255
+
+// Cerca de 10 contadores por chave: ~1% de falsos positivos com 4 sondagens
+#define BLOOM_COUNTERS_PER_KEY 10
+
+// === Filter helpers ===
+
+// Finalizador do splitmix64: espalha bem chaves sequenciais
+static uint64_t hashKey(int key)
+{
+    uint64_t x = (uint64_t)(uint32_t)key + 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Bits altos escolhem o bloco; os baixos, os contadores dentro dele
+static uint8_t* blockFor(const BloomTree* tree, uint64_t hash)
+{
+    size_t index = (size_t)(((hash >> 32) * (uint64_t)tree->blocks) >> 32);
+    return tree->counters + index * BLOOM_BLOCK_COUNTERS;
+}
+
+static int probe(uint64_t hash, int i)
+{
+    return (int)((hash >> (6 * i)) & (BLOOM_BLOCK_COUNTERS - 1));
+}
+
+static void allocCounters(BloomTree* tree, size_t expectedKeys)
+{
+    if(expectedKeys < 1) expectedKeys = 1;
+
+    tree->expectedKeys = expectedKeys;
+    tree->blocks = (expectedKeys * BLOOM_COUNTERS_PER_KEY + BLOOM_BLOCK_COUNTERS - 1) / BLOOM_BLOCK_COUNTERS;
+
+    size_t bytes = tree->blocks * BLOOM_BLOCK_COUNTERS;
+    tree->counters = (uint8_t*)aligned_alloc(BLOOM_BLOCK_COUNTERS, bytes);
+
+    if(tree->counters == NULL)
+    {
+        printf("Wasn't possible create the Bloom filter due lacking of memory.");
+        exit(1);
+    }
+
+    memset(tree->counters, 0, bytes);
+}
+
+static void filterAdd(BloomTree* tree, int key)
+{
+    uint64_t hash = hashKey(key);
+    uint8_t* block = blockFor(tree, hash);
+
+    for(int i = 0; i < BLOOM_PROBES; i++)
+    {
+        uint8_t* counter = &block[probe(hash, i)];
+        if(*counter < BLOOM_COUNTER_MAX) (*counter)++;
+    }
+}
+
+static void filterRemove(BloomTree* tree, int key)
+{
+    uint64_t hash = hashKey(key);
+    uint8_t* block = blockFor(tree, hash);
+
+    for(int i = 0; i < BLOOM_PROBES; i++)
+    {
+        uint8_t* counter = &block[probe(hash, i)];
+        if(*counter < BLOOM_COUNTER_MAX) (*counter)--;
+    }
+}
+
+static void filterTree(BloomTree* tree, Node* node)
+{
+    if(node != NULL)
+    {
+        filterAdd(tree, node->data);
+        filterTree(tree, node->left);
+        filterTree(tree, node->right);
+    }
+}
+
+// === Public functions ===
+
+void bloomTreeInit(BloomTree* tree, size_t expectedKeys)
+{
+    tree->root = NULL;
+    tree->count = 0;
+    allocCounters(tree, expectedKeys);
+}
+
+void bloomTreeInsert(BloomTree* tree, int data)
+{
+    if(bloomTreeSearch(tree, data) != NULL) return;
+
+    tree->root = insertAVL(tree->root, data);
+    tree->count++;
+
+    // Filtro cheio demais: a taxa de falsos positivos subiria
+    if(tree->count > tree->expectedKeys)
+        bloomTreeRebuild(tree, tree->expectedKeys * 2);
+    else
+        filterAdd(tree, data);
+}
+
+void bloomTreeDelete(BloomTree* tree, int data)
+{
+    // Só decrementa contadores de chaves que realmente estão na árvore
+    if(bloomTreeSearch(tree, data) == NULL) return;
+
+    tree->root = deleteNodeAVL(tree->root, data);
+    tree->count--;
+    filterRemove(tree, data);
+}
+
+int bloomMayContain(const BloomTree* tree, int data)
+{
+    uint64_t hash = hashKey(data);
+    const uint8_t* block = blockFor(tree, hash);
+
+    for(int i = 0; i < BLOOM_PROBES; i++)
+    {
+        if(block[probe(hash, i)] == 0) return 0;
+    }
+
+    return 1;
+}
+
+Node* bloomTreeSearch(const BloomTree* tree, int data)
+{
+    if(!bloomMayContain(tree, data)) return NULL;
+    return search(tree->root, data);
+}
+
+void bloomTreeRebuild(BloomTree* tree, size_t expectedKeys)
+{
+    free(tree->counters);
+    allocCounters(tree, expectedKeys);
+    filterTree(tree, tree->root);
+}
+
+void bloomTreeFree(BloomTree* tree)
+{
+    freeTree(tree->root);
+    free(tree->counters);
+    tree->root = NULL;
+    tree->counters = NULL;
+    tree->blocks = 0;
+    tree->count = 0;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "tree_template.h"
+
+// Counters per block: one block fills exactly one 64-byte cache line
+#define BLOOM_BLOCK_COUNTERS 64
+
+// Probes per key, all inside the same block
+#define BLOOM_PROBES 4
+
+// AVL tree fronted by a blocked counting Bloom filter. A key that is absent is
+// usually rejected after reading a single cache line, without walking the tree.
+// Counters (instead of bits) let deletions remove keys from the filter.
+typedef struct
+{
+    Node* root;
+    uint8_t* counters;    // blocks * BLOOM_BLOCK_COUNTERS, 64-byte aligned
+    size_t blocks;
+    size_t count;         // Keys currently in the tree
+    size_t expectedKeys;  // The filter is rebuilt twice as large past this
+} BloomTree;
+
+/**
+ * @brief Initializes an empty tree with a filter sized for expectedKeys.
+ * @param tree A pointer to the structure to be initialized.
+ * @param expectedKeys The number of keys the filter is sized for (grows automatically).
+ */
+void bloomTreeInit(BloomTree* tree, size_t expectedKeys);
+
+/**
+ * @brief Inserts a key in the AVL tree and in the filter. Duplicates are ignored.
+ * @param tree A pointer to the Bloom tree.
+ * @param data The key to be inserted.
+ */
+void bloomTreeInsert(BloomTree* tree, int data);
+
+/**
+ * @brief Deletes a key from the AVL tree and from the filter.
+ * @param tree A pointer to the Bloom tree.
+ * @param data The key to be deleted.
+ */
+void bloomTreeDelete(BloomTree* tree, int data);
+
+/**
+ * @brief Searches for a key, consulting the filter before the tree.
+ * @param tree A pointer to the Bloom tree.
+ * @param data The key to be searched for.
+ * @return A pointer to the found Node, or NULL if not found.
+ */
+Node* bloomTreeSearch(const BloomTree* tree, int data);
+
+/**
+ * @brief Checks only the filter.
+ * @param tree A pointer to the Bloom tree.
+ * @param data The key to be checked.
+ * @return 0 if the key is certainly absent, 1 if it may be present.
+ */
+int bloomMayContain(const BloomTree* tree, int data);
+
+/**
+ * @brief Rebuilds the filter from the tree, sized for expectedKeys.
+ * Clears saturated counters and false positives left by past deletions.
+ * @param tree A pointer to the Bloom tree.
+ * @param expectedKeys The number of keys the new filter is sized for.
+ */
+void bloomTreeRebuild(BloomTree* tree, size_t expectedKeys);
+
+/**
+ * @brief Frees the tree and the filter.
+ * @param tree A pointer to the Bloom tree.
+ * @note Call bloomTreeInit again before reusing the structure.
+ */
+void bloomTreeFree(BloomTree* tree);
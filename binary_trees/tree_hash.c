@@ -0,0 +1,189 @@
+#include <stdint.h>
+#include "tree_hash.h"
+
+#define HASH_MIN_CAPACITY 16
+
+// === Index helpers ===
+
+// Hash multiplicativo (Fibonacci): usa os bits altos do produto
+static size_t homeSlot(const HashedTree* tree, int key)
+{
+    return (size_t)(((uint32_t)key * 2654435761u) >> tree->shift);
+}
+
+static void allocSlots(HashedTree* tree, size_t capacity)
+{
+    tree->slots = (HashSlot*)calloc(capacity, sizeof(HashSlot));
+
+    if(tree->slots == NULL)
+    {
+        printf("Wasn't possible create the hash index due lacking of memory.");
+        exit(1);
+    }
+
+    tree->capacity = capacity;
+    tree->count = 0;
+    tree->shift = 32;
+    while(capacity > 1)
+    {
+        capacity >>= 1;
+        tree->shift--;
+    }
+}
+
+// Retorna o slot que contém a chave, ou o slot vazio onde ela deveria estar
+static size_t findSlot(const HashedTree* tree, int key)
+{
+    size_t mask = tree->capacity - 1;
+    size_t i = homeSlot(tree, key);
+
+    while(tree->slots[i].node != NULL && tree->slots[i].key != key)
+    {
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+static void indexPut(HashedTree* tree, int key, Node* node);
+
+static void growIndex(HashedTree* tree)
+{
+    HashSlot* old = tree->slots;
+    size_t oldCapacity = tree->capacity;
+
+    allocSlots(tree, oldCapacity * 2);
+    for(size_t i = 0; i < oldCapacity; i++)
+    {
+        if(old[i].node != NULL) indexPut(tree, old[i].key, old[i].node);
+    }
+
+    free(old);
+}
+
+static void indexPut(HashedTree* tree, int key, Node* node)
+{
+    // Mantém o fator de carga abaixo de 0.7
+    if((tree->count + 1) * 10 > tree->capacity * 7) growIndex(tree);
+
+    size_t i = findSlot(tree, key);
+    if(tree->slots[i].node == NULL) tree->count++;
+
+    tree->slots[i].key = key;
+    tree->slots[i].node = node;
+}
+
+// Remoção com deslocamento para trás: não deixa lápides na sondagem linear
+static void indexRemove(HashedTree* tree, int key)
+{
+    size_t mask = tree->capacity - 1;
+    size_t hole = findSlot(tree, key);
+
+    if(tree->slots[hole].node == NULL) return;
+
+    size_t j = hole;
+    while(1)
+    {
+        j = (j + 1) & mask;
+        if(tree->slots[j].node == NULL) break;
+
+        size_t home = homeSlot(tree, tree->slots[j].key);
+
+        // A entrada em j pode ocupar o buraco se o seu slot de origem não estiver entre (hole, j]
+        int canMove = (hole <= j) ? (home <= hole || home > j)
+                                  : (home <= hole && home > j);
+        if(canMove)
+        {
+            tree->slots[hole] = tree->slots[j];
+            hole = j;
+        }
+    }
+
+    tree->slots[hole].node = NULL;
+    tree->count--;
+}
+
+static void indexTree(HashedTree* tree, Node* node)
+{
+    if(node != NULL)
+    {
+        indexPut(tree, node->data, node);
+        indexTree(tree, node->left);
+        indexTree(tree, node->right);
+    }
+}
+
+// === Public functions ===
+
+void hashedTreeInit(HashedTree* tree)
+{
+    tree->root = NULL;
+    allocSlots(tree, HASH_MIN_CAPACITY);
+}
+
+void hashedTreeInsert(HashedTree* tree, int data)
+{
+    if(hashedTreeFind(tree, data) != NULL) return;
+
+    tree->root = insertAVL(tree->root, data);
+
+    // As rotações só religam ponteiros, então basta localizar o nó novo
+    indexPut(tree, data, search(tree->root, data));
+}
+
+void hashedTreeDelete(HashedTree* tree, int data)
+{
+    Node* target = hashedTreeFind(tree, data);
+    if(target == NULL) return;
+
+    // deleteNodeAVL copia conteúdo entre nós em vez de religá-los:
+    // anota as (no máximo duas) chaves que vão mudar de endereço.
+    int moved[2];
+    int movedCount = 0;
+
+    if(target->left != NULL && target->right != NULL)
+    {
+        Node* successor = findMinValue(target->right);
+        moved[movedCount++] = successor->data;
+        if(successor->right != NULL) moved[movedCount++] = successor->right->data;
+    }
+    else if(target->left != NULL || target->right != NULL)
+    {
+        moved[movedCount++] = target->left ? target->left->data : target->right->data;
+    }
+
+    tree->root = deleteNodeAVL(tree->root, data);
+    indexRemove(tree, data);
+
+    for(int i = 0; i < movedCount; i++)
+    {
+        indexPut(tree, moved[i], search(tree->root, moved[i]));
+    }
+}
+
+Node* hashedTreeFind(const HashedTree* tree, int data)
+{
+    return tree->slots[findSlot(tree, data)].node;
+}
+
+int hashedTreeContains(const HashedTree* tree, int data)
+{
+    return hashedTreeFind(tree, data) != NULL;
+}
+
+void hashedTreeReindex(HashedTree* tree)
+{
+    free(tree->slots);
+    allocSlots(tree, HASH_MIN_CAPACITY);
+    indexTree(tree, tree->root);
+}
+
+void hashedTreeFree(HashedTree* tree)
+{
+    freeTree(tree->root);
+    free(tree->slots);
+    tree->root = NULL;
+    tree->slots = NULL;
+    tree->capacity = 0;
+    tree->count = 0;
+}
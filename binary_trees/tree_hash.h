@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+#include "tree_template.h"
+
+// One slot of the open-addressing index (node == NULL means the slot is empty)
+typedef struct
+{
+    int key;
+    Node* node;
+} HashSlot;
+
+// AVL tree plus a hash index key -> Node* kept in sync with it.
+// Exact lookups go through the index; ordered operations (findMinValue,
+// findMaxValue, traversals...) keep using `root` directly.
+typedef struct
+{
+    Node* root;
+    HashSlot* slots;
+    size_t capacity; // Always a power of two
+    size_t count;
+    int shift;       // 32 - log2(capacity), used by the multiplicative hash
+} HashedTree;
+
+/**
+ * @brief Initializes an empty hashed tree.
+ * @param tree A pointer to the structure to be initialized.
+ */
+void hashedTreeInit(HashedTree* tree);
+
+/**
+ * @brief Inserts a key in the AVL tree and in the hash index. Duplicates are ignored.
+ * @param tree A pointer to the hashed tree.
+ * @param data The key to be inserted.
+ */
+void hashedTreeInsert(HashedTree* tree, int data);
+
+/**
+ * @brief Deletes a key from the AVL tree and from the hash index.
+ * @param tree A pointer to the hashed tree.
+ * @param data The key to be deleted.
+ */
+void hashedTreeDelete(HashedTree* tree, int data);
+
+/**
+ * @brief Finds the Node holding a key in O(1) expected time.
+ * @param tree A pointer to the hashed tree.
+ * @param data The key to be searched for.
+ * @return A pointer to the Node, or NULL if the key is not present.
+ */
+Node* hashedTreeFind(const HashedTree* tree, int data);
+
+/**
+ * @brief Checks whether a key is present in O(1) expected time.
+ * @param tree A pointer to the hashed tree.
+ * @param data The key to be checked.
+ * @return 1 if the key is present, 0 otherwise.
+ */
+int hashedTreeContains(const HashedTree* tree, int data);
+
+/**
+ * @brief Rebuilds the hash index from the tree.
+ * @param tree A pointer to the hashed tree.
+ * @note Must be called if `root` is modified without the hashedTree* functions.
+ */
+void hashedTreeReindex(HashedTree* tree);
+
+/**
+ * @brief Frees the tree and the hash index.
+ * @param tree A pointer to the hashed tree.
+ * @note Call hashedTreeInit again before reusing the structure.
+ */
+void hashedTreeFree(HashedTree* tree);
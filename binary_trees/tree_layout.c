@@ -0,0 +1,136 @@
+#include "tree_layout.h"
+
+// === Helpers ===
+
+static size_t countTreeNodes(Node* root)
+{
+    if(root == NULL) return 0;
+    return 1 + countTreeNodes(root->left) + countTreeNodes(root->right);
+}
+
+// Altura real (não confia no campo height, que só a AVL mantém)
+static int measureHeight(Node* root)
+{
+    if(root == NULL) return 0;
+    return 1 + max(measureHeight(root->left), measureHeight(root->right));
+}
+
+static void placeVEB(Node** link, int levels, NodeBlock* block);
+
+// Aplica placeVEB em cada subárvore que começa `depth` níveis abaixo de *link
+static void placeFrontier(Node** link, int depth, int levels, NodeBlock* block)
+{
+    if(*link == NULL) return;
+
+    if(depth == 0)
+    {
+        placeVEB(link, levels, block);
+        return;
+    }
+
+    placeFrontier(&(*link)->left, depth - 1, levels, block);
+    placeFrontier(&(*link)->right, depth - 1, levels, block);
+}
+
+// Copia os `levels` primeiros níveis da subárvore *link para o bloco em ordem vEB:
+// primeiro a metade de cima (recursivamente), depois cada subárvore de baixo.
+// Os filhos abaixo desses níveis continuam apontando para os nós antigos.
+static void placeVEB(Node** link, int levels, NodeBlock* block)
+{
+    if(*link == NULL || levels <= 0) return;
+
+    if(levels == 1)
+    {
+        Node* copy = takeNodeFromBlock(block);
+        if(copy == NULL) return; // Bloco cheio: o nó fica onde está
+
+        *copy = **link;
+        releaseNode(*link);
+        *link = copy;
+        return;
+    }
+
+    int top = levels / 2;
+    placeVEB(link, top, block);
+    placeFrontier(link, top, levels - top, block);
+}
+
+// Encontra a próxima subárvore (em ordem) na profundidade `depth` cuja raiz seja > lastKey
+static Node** findNextBottom(Node** link, int depth, const VebCompactor* compactor)
+{
+    if(*link == NULL) return NULL;
+
+    if(depth == 0)
+    {
+        if(!compactor->hasLastKey || (*link)->data > compactor->lastKey) return link;
+        return NULL;
+    }
+
+    // Se a raiz já é <= lastKey, toda a subárvore esquerda também é
+    if(!compactor->hasLastKey || (*link)->data > compactor->lastKey)
+    {
+        Node** found = findNextBottom(&(*link)->left, depth - 1, compactor);
+        if(found != NULL) return found;
+    }
+
+    return findNextBottom(&(*link)->right, depth - 1, compactor);
+}
+
+// === Public functions ===
+
+void compactorInit(VebCompactor* compactor, Node* root)
+{
+    compactor->block = createNodeBlock(countTreeNodes(root));
+    compactor->phase = COMPACT_TOP;
+    compactor->topHeight = measureHeight(root) / 2;
+    compactor->hasLastKey = 0;
+    compactor->lastKey = 0;
+}
+
+Node* compactorStep(VebCompactor* compactor, Node* root)
+{
+    if(compactor->phase == COMPACT_TOP)
+    {
+        placeVEB(&root, compactor->topHeight, compactor->block);
+        compactor->phase = COMPACT_BOTTOM;
+        return root;
+    }
+
+    if(compactor->phase == COMPACT_BOTTOM)
+    {
+        Node** link = findNextBottom(&root, compactor->topHeight, compactor);
+
+        if(link == NULL)
+        {
+            // Todas as subárvores foram movidas
+            sealNodeBlock(compactor->block);
+            compactor->block = NULL;
+            compactor->phase = COMPACT_DONE;
+            return root;
+        }
+
+        placeVEB(link, measureHeight(*link), compactor->block);
+        compactor->lastKey = findMaxValue(*link)->data;
+        compactor->hasLastKey = 1;
+    }
+
+    return root;
+}
+
+int compactorDone(const VebCompactor* compactor)
+{
+    return compactor->phase == COMPACT_DONE;
+}
+
+Node* compactTreeVEB(Node* root)
+{
+    VebCompactor compactor;
+
+    compactorInit(&compactor, root);
+    while(!compactorDone(&compactor))
+    {
+        root = compactorStep(&compactor, root);
+    }
+
+    return root;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "tree_template.h"
+
+// Compaction phases
+typedef enum
+{
+    COMPACT_TOP = 0, // Next step relocates the top levels of the tree
+    COMPACT_BOTTOM,  // Next steps relocate the bottom subtrees, left to right
+    COMPACT_DONE
+} CompactPhase;
+
+// State of an incremental van Emde Boas compaction. The tree may be modified
+// between steps: nodes moved by rotations or inserted later simply stay where
+// they are until the next compaction.
+typedef struct
+{
+    NodeBlock* block;
+    CompactPhase phase;
+    int topHeight;   // The top part is made of depths [0, topHeight)
+    int hasLastKey;
+    int lastKey;     // Largest key of the last relocated bottom subtree
+} VebCompactor;
+
+/**
+ * @brief Prepares an incremental compaction of the tree (one O(n) pass to size the block).
+ * @param compactor A pointer to the compactor state.
+ * @param root A pointer to the root of the tree.
+ */
+void compactorInit(VebCompactor* compactor, Node* root);
+
+/**
+ * @brief Runs one compaction step: the top levels on the first call, then one bottom
+ * subtree (about sqrt(n) nodes) per call. Suitable for idle-time scheduling.
+ * @param compactor A pointer to the compactor state.
+ * @param root A pointer to the root of the tree.
+ * @return A pointer to the (possibly relocated) root of the tree.
+ * @note Node addresses change: anything holding Node* (e.g. HashedTree) must be reindexed.
+ */
+Node* compactorStep(VebCompactor* compactor, Node* root);
+
+/**
+ * @brief Checks whether an incremental compaction has finished.
+ * @param compactor A pointer to the compactor state.
+ * @return 1 if there are no more steps to run, 0 otherwise.
+ */
+int compactorDone(const VebCompactor* compactor);
+
+/**
+ * @brief Copies the whole tree into one contiguous block in van Emde Boas order.
+ * The result is an ordinary tree: inserts, deletes and freeTree keep working.
+ * @param root A pointer to the root of the tree.
+ * @return A pointer to the relocated root of the tree.
+ * @note Node addresses change: anything holding Node* (e.g. HashedTree) must be reindexed.
+ */
+Node* compactTreeVEB(Node* root);
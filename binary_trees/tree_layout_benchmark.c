@@ -0,0 +1,127 @@
+/*
+Benchmark da compactação em ordem van Emde Boas (tree_layout.c).
+
+Monta uma AVL, embaralha os nós no heap com uma sequência de remoções e
+inserções aleatórias e mede o tempo médio de `search` antes e depois de
+compactTreeVEB. Em seguida aplica mais churn para mostrar que a árvore
+continua mutável depois da compactação.
+
+Compilar: gcc -O2 tree_layout_benchmark.c tree_layout.c tree_template.c -o tree_layout_benchmark
+Uso:      ./tree_layout_benchmark [nós] [buscas]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tree_layout.h"
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Gerador simples e reprodutível (xorshift)
+static unsigned int rngState = 2463534242u;
+static int nextRandom(void)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (int)(rngState & 0x7fffffff);
+}
+
+// Sorteia uma chave que ainda não está na árvore
+static int freshKey(Node* root)
+{
+    int key;
+    do
+    {
+        key = nextRandom();
+    } while(search(root, key) != NULL);
+    return key;
+}
+
+// Retorna o tempo médio por busca em nanossegundos
+static double measureLookups(Node* root, const int keys[], int queries)
+{
+    int found = 0;
+    double start = nowSeconds();
+
+    for(int i = 0; i < queries; i++)
+    {
+        if(search(root, keys[i]) != NULL) found++;
+    }
+
+    double elapsed = nowSeconds() - start;
+    if(found != queries) printf("Aviso: %d chaves não encontradas.\n", queries - found);
+    return elapsed * 1e9 / queries;
+}
+
+int main(int argc, char* argv[])
+{
+    int nodes = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int queries = (argc > 2) ? atoi(argv[2]) : 2000000;
+
+    int* present = (int*)malloc(sizeof(int) * nodes);
+    int* keys = (int*)malloc(sizeof(int) * queries);
+    if(present == NULL || keys == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        return 1;
+    }
+
+    // 1. Monta a árvore e aplica churn para espalhar os nós no heap
+    Node* root = NULL;
+    for(int i = 0; i < nodes; i++)
+    {
+        present[i] = freshKey(root);
+        root = insertAVL(root, present[i]);
+    }
+    for(int round = 0; round < 4 * nodes; round++)
+    {
+        int victim = nextRandom() % nodes;
+        root = deleteNodeAVL(root, present[victim]);
+        present[victim] = freshKey(root);
+        root = insertAVL(root, present[victim]);
+    }
+
+    for(int i = 0; i < queries; i++)
+    {
+        keys[i] = present[nextRandom() % nodes];
+    }
+
+    double before = measureLookups(root, keys, queries);
+
+    // 2. Compacta e mede de novo
+    double start = nowSeconds();
+    root = compactTreeVEB(root);
+    double compactTime = nowSeconds() - start;
+
+    double after = measureLookups(root, keys, queries);
+
+    // 3. A árvore compactada continua aceitando inserções e remoções
+    for(int round = 0; round < nodes / 10; round++)
+    {
+        int victim = nextRandom() % nodes;
+        root = deleteNodeAVL(root, present[victim]);
+        present[victim] = freshKey(root);
+        root = insertAVL(root, present[victim]);
+    }
+    for(int i = 0; i < queries; i++)
+    {
+        keys[i] = present[nextRandom() % nodes];
+    }
+    double afterChurn = measureLookups(root, keys, queries);
+
+    printf("Nós: %d | Buscas: %d | Altura: %d\n", nodes, queries, height(root));
+    printf("Antes da compactação:        %8.1f ns/busca\n", before);
+    printf("Depois da compactação:       %8.1f ns/busca (compactação levou %.3f s)\n", after, compactTime);
+    printf("Depois de 10%% de churn extra: %8.1f ns/busca\n", afterChurn);
+
+    freeTree(root);
+    free(present);
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,264 @@
+#include "tree_lazy.h"
+
+// === Node helpers ===
+
+static LazyNode* createLazyNode(int data)
+{
+    LazyNode* newNode = (LazyNode*)malloc(sizeof(LazyNode));
+
+    if(newNode == NULL)
+    {
+        printf("Wasn't possible create a new Node due lacking of memory.");
+        exit(1);
+    }
+
+    newNode->data = data;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    newNode->height = 1;
+    newNode->size = 1;
+    newNode->dead = 0;
+    newNode->deleted = 0;
+
+    return newNode;
+}
+
+static int lazyHeight(LazyNode* node) { return node ? node->height : 0; }
+static int lazySize(LazyNode* node)   { return node ? node->size : 0; }
+static int lazyDead(LazyNode* node)   { return node ? node->dead : 0; }
+
+static int lazyBalance(LazyNode* node)
+{
+    return node ? lazyHeight(node->left) - lazyHeight(node->right) : 0;
+}
+
+// Recalcula altura, tamanho e lápides a partir dos filhos
+static void updateLazyNode(LazyNode* node)
+{
+    int hl = lazyHeight(node->left);
+    int hr = lazyHeight(node->right);
+
+    node->height = 1 + (hl > hr ? hl : hr);
+    node->size = 1 + lazySize(node->left) + lazySize(node->right);
+    node->dead = node->deleted + lazyDead(node->left) + lazyDead(node->right);
+}
+
+static LazyNode* lazyRightRotate(LazyNode* y)
+{
+    LazyNode* x = y->left;
+    y->left = x->right;
+    x->right = y;
+
+    updateLazyNode(y);
+    updateLazyNode(x);
+    return x;
+}
+
+static LazyNode* lazyLeftRotate(LazyNode* x)
+{
+    LazyNode* y = x->right;
+    x->right = y->left;
+    y->left = x;
+
+    updateLazyNode(x);
+    updateLazyNode(y);
+    return y;
+}
+
+// === Rebuild ===
+
+// Guarda os nós vivos em ordem e libera as lápides
+static void collectLive(LazyNode* node, LazyNode** out, int* count)
+{
+    if(node == NULL) return;
+
+    collectLive(node->left, out, count);
+    LazyNode* right = node->right;
+    if(node->deleted)
+        free(node);
+    else
+        out[(*count)++] = node;
+    collectLive(right, out, count);
+}
+
+// Monta uma árvore perfeitamente balanceada reaproveitando os nós
+static LazyNode* buildBalanced(LazyNode** nodes, int lo, int hi)
+{
+    if(lo > hi) return NULL;
+
+    int mid = lo + (hi - lo) / 2;
+    LazyNode* root = nodes[mid];
+    root->left = buildBalanced(nodes, lo, mid - 1);
+    root->right = buildBalanced(nodes, mid + 1, hi);
+    updateLazyNode(root);
+
+    return root;
+}
+
+static LazyNode* rebuildSubtree(LazyNode* root)
+{
+    int live = root->size - root->dead;
+    if(live == 0)
+    {
+        freeLazyTree(root);
+        return NULL;
+    }
+
+    LazyNode** nodes = (LazyNode**)malloc(sizeof(LazyNode*) * live);
+    if(nodes == NULL)
+    {
+        printf("Wasn't possible rebuild the tree due lacking of memory.");
+        exit(1);
+    }
+
+    int count = 0;
+    collectLive(root, nodes, &count);
+    root = buildBalanced(nodes, 0, count - 1);
+
+    free(nodes);
+    return root;
+}
+
+// === Public functions ===
+
+LazyNode* lazyInsert(LazyNode* node, int data)
+{
+    if(node == NULL) return createLazyNode(data);
+
+    if(data < node->data)
+    {
+        node->left = lazyInsert(node->left, data);
+    }
+    else if(data > node->data)
+    {
+        node->right = lazyInsert(node->right, data);
+    }
+    else
+    {
+        // Chave já existe: se for lápide, volta a ficar viva
+        if(node->deleted)
+        {
+            node->deleted = 0;
+            node->dead--;
+        }
+        return node;
+    }
+
+    updateLazyNode(node);
+    int balance = lazyBalance(node);
+
+    // Caso Esquerda-Esquerda
+    if(balance > 1 && data < node->left->data) return lazyRightRotate(node);
+
+    // Caso Direita-Direita
+    if(balance < -1 && data > node->right->data) return lazyLeftRotate(node);
+
+    // Caso Esquerda-Direita
+    if(balance > 1 && data > node->left->data)
+    {
+        node->left = lazyLeftRotate(node->left);
+        return lazyRightRotate(node);
+    }
+
+    // Caso Direita-Esquerda
+    if(balance < -1 && data < node->right->data)
+    {
+        node->right = lazyRightRotate(node->right);
+        return lazyLeftRotate(node);
+    }
+
+    return node;
+}
+
+LazyNode* lazyDelete(LazyNode* node, int data, double maxGarbageRatio)
+{
+    if(node == NULL) return node;
+
+    if(data < node->data)
+        node->left = lazyDelete(node->left, data, maxGarbageRatio);
+    else if(data > node->data)
+        node->right = lazyDelete(node->right, data, maxGarbageRatio);
+    else if(!node->deleted)
+        node->deleted = 1; // Apenas marca: nenhuma rotação, nenhum free
+    else
+        return node;       // Já era lápide
+
+    updateLazyNode(node);
+
+    // Subárvore com lixo demais: reconstrói de uma vez
+    if(node->size >= LAZY_MIN_REBUILD_SIZE && node->dead > maxGarbageRatio * node->size)
+        return rebuildSubtree(node);
+
+    // Uma reconstrução abaixo pode ter reduzido a altura de um filho
+    int balance = lazyBalance(node);
+    if(balance > 2 || balance < -2)
+        return rebuildSubtree(node);
+
+    // Caso Esquerda-Esquerda (LL)
+    if(balance > 1 && lazyBalance(node->left) >= 0)
+        return lazyRightRotate(node);
+
+    // Caso Esquerda-Direita (LR)
+    if(balance > 1)
+    {
+        node->left = lazyLeftRotate(node->left);
+        return lazyRightRotate(node);
+    }
+
+    // Caso Direita-Direita (RR)
+    if(balance < -1 && lazyBalance(node->right) <= 0)
+        return lazyLeftRotate(node);
+
+    // Caso Direita-Esquerda (RL)
+    if(balance < -1)
+    {
+        node->right = lazyRightRotate(node->right);
+        return lazyLeftRotate(node);
+    }
+
+    return node;
+}
+
+LazyNode* lazySearch(LazyNode* root, int data)
+{
+    LazyNode* current = root;
+
+    while(current != NULL && current->data != data)
+    {
+        current = (data < current->data) ? current->left : current->right;
+    }
+
+    if(current != NULL && current->deleted) return NULL;
+    return current;
+}
+
+void lazyInOrderTraversal(LazyNode* root)
+{
+    if(root != NULL)
+    {
+        lazyInOrderTraversal(root->left);
+        if(!root->deleted) printf("%d ", root->data);
+        lazyInOrderTraversal(root->right);
+    }
+}
+
+int lazyCount(LazyNode* root)
+{
+    return lazySize(root) - lazyDead(root);
+}
+
+LazyNode* lazyCompact(LazyNode* root)
+{
+    if(root == NULL || root->dead == 0) return root;
+    return rebuildSubtree(root);
+}
+
+void freeLazyTree(LazyNode* root)
+{
+    if(root != NULL)
+    {
+        freeLazyTree(root->left);
+        freeLazyTree(root->right);
+        free(root);
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdlib.h>
+#include <stdio.h>
+
+// Default fraction of tombstones that triggers the rebuild of a subtree
+#define LAZY_DEFAULT_GARBAGE_RATIO 0.5
+
+// Subtrees smaller than this are never rebuilt on their own (their ancestors are)
+#define LAZY_MIN_REBUILD_SIZE 32
+
+// AVL node with tombstone support: deleted nodes stay in place until their
+// subtree accumulates enough garbage to be rebuilt in one pass.
+typedef struct LazyNode
+{
+    int data;
+    struct LazyNode* left;
+    struct LazyNode* right;
+    int height;
+    int size;    // Nodes in the subtree, tombstones included
+    int dead;    // Tombstones in the subtree
+    int deleted; // 1 if this node is a tombstone
+} LazyNode;
+
+/**
+ * @brief Inserts a key in the lazy AVL tree. A tombstone with the same key is revived.
+ * @param root A pointer to the root of the tree.
+ * @param data The key to be inserted.
+ * @return A pointer to the root of the modified tree.
+ */
+LazyNode* lazyInsert(LazyNode* root, int data);
+
+/**
+ * @brief Deletes a key by marking its Node as a tombstone, without rotations or free.
+ * A subtree is rebuilt (tombstones freed, live nodes perfectly balanced) once its
+ * tombstones exceed maxGarbageRatio of its size.
+ * @param root A pointer to the root of the tree.
+ * @param data The key to be deleted.
+ * @param maxGarbageRatio Tombstone fraction that triggers a rebuild (e.g. LAZY_DEFAULT_GARBAGE_RATIO).
+ * @return A pointer to the root of the modified tree.
+ */
+LazyNode* lazyDelete(LazyNode* root, int data, double maxGarbageRatio);
+
+/**
+ * @brief Searches for a live Node with the specified key (tombstones are skipped).
+ * @param root A pointer to the root of the tree.
+ * @param data The key to be searched for.
+ * @return A pointer to the found Node, or NULL if not found or deleted.
+ */
+LazyNode* lazySearch(LazyNode* root, int data);
+
+/**
+ * @brief Prints the live keys in order (tombstones are skipped).
+ * @param root A pointer to the root of the tree.
+ */
+void lazyInOrderTraversal(LazyNode* root);
+
+/**
+ * @brief Returns the number of live keys in O(1).
+ * @param root A pointer to the root of the tree.
+ * @return The number of keys that are not tombstones.
+ */
+int lazyCount(LazyNode* root);
+
+/**
+ * @brief Rebuilds the whole tree now, freeing every tombstone.
+ * Meant to be scheduled in idle time so later deletes never pay for a rebuild.
+ * @param root A pointer to the root of the tree.
+ * @return A pointer to the root of the compacted tree.
+ */
+LazyNode* lazyCompact(LazyNode* root);
+
+/**
+ * @brief Frees every Node of the tree, tombstones included.
+ * @param root A pointer to the root of the tree.
+ */
+void freeLazyTree(LazyNode* root);
@@ -10,12 +10,25 @@ Faça um programa para executar as operações abaixo em uma árvore binária de
 7. Mostrar os filhos de um determinado nó (caso existam)
 8. Mostrar a profundidade de um determinado nó, listando o caminho percorrido
 9. Sair (remover a árvore antes de fechar o programa).
+
+Batch mode (for load tests): ./tree_problem --batch [file]
+Reads one command per line from the file (or stdin): insert N, delete N,
+search N, count, sum, path N. Results are written to stdout and per-operation
+latency statistics to stderr at the end.
+
+Recording: ./tree_problem --record <trace> [--batch [file]]
+Writes every tree operation (menu or batch) to a binary trace that
+trace_replay can run against the other tree implementations.
+Compile with: gcc tree_problem.c tree_trace.c -o tree_problem
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <time.h>
+#include <limits.h>
+#include "tree_trace.h"
 
 // --- Tree Node Structure ---
 typedef struct Node {
@@ -44,14 +57,59 @@ void freeTree(Node* root);                      // 9. Free the tree from memory
 // Helper functions
 Node* createNode(int data);
 Node* findNode(Node* root, int data); // Helper to find a node
+Node* deleteNode(Node* root, int data); // Removes a node (used by batch mode)
 Node* setupInitialTree(Node* root);     // Check if the user wanna create a new tree or not
 
+// Batch mode
+int runBatchMode(FILE* input);          // Runs a command stream without prompts
+
+// Trace recording (--record)
+static TraceWriter recorder;
+static bool recording = false;
+
+// Appends an operation to the trace when recording is on
+static void recordOperation(TraceOp op, int a, int b) {
+    if (recording) {
+        traceWrite(&recorder, op, a, b);
+    }
+}
+
 // ===== Main Function =====
 
-int main() {
+int main(int argc, char* argv[]) {
     Node* root = NULL;
     int choice = 0;
     int num;
+    int arg = 1;
+
+    if (argc > arg + 1 && strcmp(argv[arg], "--record") == 0) {
+        if (!traceWriterOpen(&recorder, argv[arg + 1])) {
+            perror("Could not create the trace file");
+            return 1;
+        }
+        recording = true;
+        arg += 2;
+    }
+
+    if (argc > arg && strcmp(argv[arg], "--batch") == 0) {
+        FILE* input = stdin;
+        if (argc > arg + 1 && strcmp(argv[arg + 1], "-") != 0) {
+            input = fopen(argv[arg + 1], "r");
+            if (input == NULL) {
+                perror("Could not open the command file");
+                return 1;
+            }
+        }
+        int status = runBatchMode(input);
+        if (input != stdin) {
+            fclose(input);
+        }
+        if (recording) {
+            fprintf(stderr, "Recorded %zu operation(s).\n", recorder.records);
+            traceWriterClose(&recorder);
+        }
+        return status;
+    }
 
     root = setupInitialTree(root);
 
@@ -76,6 +134,7 @@ int main() {
                 printf("Enter the number to insert: ");
                 scanf("%d", &num);
                 root = insert(root, num);
+                recordOperation(TRACE_INSERT, num, 0);
                 printf("Number %d inserted successfully!\n", num);
                 break;
             case 2:
@@ -85,6 +144,7 @@ int main() {
                 } else {
                     showAll(root);
                 }
+                recordOperation(TRACE_RANGE, INT_MIN, INT_MAX);
                 printf("\n");
                 break;
             case 3:
@@ -95,24 +155,32 @@ int main() {
                 break;
             case 5:
                 printf("The tree has %d node(s).\n", countNodes(root));
+                recordOperation(TRACE_RANGE, INT_MIN, INT_MAX);
                 break;
             case 6:
                  printf("The sum of all nodes is: %d.\n", sumNodes(root));
+                recordOperation(TRACE_RANGE, INT_MIN, INT_MAX);
                 break;
             case 7:
                 printf("Enter the node to see its children: ");
                 scanf("%d", &num);
                 showChildren(root, num);
+                recordOperation(TRACE_SEARCH, num, 0);
                 break;
             case 8:
                 printf("Enter the node to see its path and depth: ");
                 scanf("%d", &num);
                 showPath(root, num);
+                recordOperation(TRACE_SEARCH, num, 0);
                 break;
             case 9:
                 printf("Exiting and freeing tree memory...\n");
                 freeTree(root);
                 root = NULL; // Important: set root to null after freeing
+                if (recording) {
+                    printf("Recorded %zu operation(s).\n", recorder.records);
+                    traceWriterClose(&recorder);
+                }
                 printf("Program finished.\n");
                 break;
             default:
@@ -214,6 +282,36 @@ Node* findNode(Node* root, int data) {
     return findNode(root->right, data);
 }
 
+// Helper function to remove a node by its value
+Node* deleteNode(Node* root, int data) {
+    if (root == NULL) {
+        return root;
+    }
+    if (data < root->data) {
+        root->left = deleteNode(root->left, data);
+    } else if (data > root->data) {
+        root->right = deleteNode(root->right, data);
+    } else {
+        if (root->left == NULL) {
+            Node* temp = root->right;
+            free(root);
+            return temp;
+        } else if (root->right == NULL) {
+            Node* temp = root->left;
+            free(root);
+            return temp;
+        }
+        // Two children: copy the in-order successor and remove it from the right subtree
+        Node* successor = root->right;
+        while (successor->left != NULL) {
+            successor = successor->left;
+        }
+        root->data = successor->data;
+        root->right = deleteNode(root->right, successor->data);
+    }
+    return root;
+}
+
 // 7. Show the children of a specific node
 void showChildren(Node* root, int data) {
     Node* parent = findNode(root, data);
@@ -270,13 +368,20 @@ void showPath(Node* root, int data) {
 
 // 9. Free the entire tree from memory
 void freeTree(Node* root) {
-    if (root == NULL) {
-        return;
+    // Rotate left children up until the tree is a right spine, freeing it as we go.
+    // No recursion, so trees built from sorted input (one long chain) are fine too
+    while (root != NULL) {
+        if (root->left != NULL) {
+            Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            Node* next = root->right;
+            free(root);
+            root = next;
+        }
     }
-    // Use post-order traversal to free children before the parent
-    freeTree(root->left);
-    freeTree(root->right);
-    free(root);
 }
 
 // Helper function to ask the user about initializing the tree
@@ -300,4 +405,151 @@ Node* setupInitialTree(Node* root) {
         printf("Starting with an empty tree.\n");
     }
     return root;
-}
\ No newline at end of file
+}
+
+// ===== Batch Mode =====
+
+// Large stdio buffers so a million commands don't cost a million syscalls
+#define BATCH_IO_BUFFER_SIZE (1 << 20)
+
+typedef enum {
+    OP_INSERT = 0,
+    OP_DELETE,
+    OP_SEARCH,
+    OP_COUNT,
+    OP_SUM,
+    OP_PATH,
+    OP_TOTAL
+} BatchOperation;
+
+static const char* batchOperationNames[OP_TOTAL] = {
+    "insert", "delete", "search", "count", "sum", "path"
+};
+
+// Latency accumulated for one kind of operation
+typedef struct {
+    unsigned long long count;
+    unsigned long long totalNs;
+    unsigned long long minNs;
+    unsigned long long maxNs;
+} LatencyStats;
+
+static unsigned long long nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+static void recordLatency(LatencyStats* stats, unsigned long long elapsedNs) {
+    if (stats->count == 0 || elapsedNs < stats->minNs) {
+        stats->minNs = elapsedNs;
+    }
+    if (elapsedNs > stats->maxNs) {
+        stats->maxNs = elapsedNs;
+    }
+    stats->totalNs += elapsedNs;
+    stats->count++;
+}
+
+// Returns the operation for a command word, or OP_TOTAL if it is unknown
+static BatchOperation parseOperation(const char* word) {
+    for (int op = 0; op < OP_TOTAL; op++) {
+        if (strcmp(word, batchOperationNames[op]) == 0) {
+            return (BatchOperation)op;
+        }
+    }
+    return OP_TOTAL;
+}
+
+// Reads commands until EOF, runs them on a fresh tree and prints the latency report.
+// Returns 0 on success or 1 if any line could not be parsed.
+int runBatchMode(FILE* input) {
+    Node* root = NULL;
+    LatencyStats stats[OP_TOTAL];
+    char line[128];
+    char word[16];
+    int num;
+    int lineNumber = 0;
+    int errors = 0;
+
+    memset(stats, 0, sizeof(stats));
+    setvbuf(input, NULL, _IOFBF, BATCH_IO_BUFFER_SIZE);
+    setvbuf(stdout, NULL, _IOFBF, BATCH_IO_BUFFER_SIZE);
+
+    unsigned long long batchStart = nowNs();
+
+    while (fgets(line, sizeof(line), input) != NULL) {
+        lineNumber++;
+
+        int fields = sscanf(line, "%15s %d", word, &num);
+        if (fields < 1 || word[0] == '#') {
+            continue; // Blank line or comment
+        }
+
+        BatchOperation op = parseOperation(word);
+        bool needsNumber = (op == OP_INSERT || op == OP_DELETE || op == OP_SEARCH || op == OP_PATH);
+        if (op == OP_TOTAL || (needsNumber && fields < 2)) {
+            fprintf(stderr, "Line %d: invalid command: %s", lineNumber, line);
+            errors = 1;
+            continue;
+        }
+
+        unsigned long long start = nowNs();
+        switch (op) {
+            case OP_INSERT:
+                root = insert(root, num);
+                break;
+            case OP_DELETE:
+                root = deleteNode(root, num);
+                break;
+            case OP_SEARCH:
+                printf("%d %s\n", num, findNode(root, num) != NULL ? "found" : "not found");
+                break;
+            case OP_COUNT:
+                printf("%d\n", countNodes(root));
+                break;
+            case OP_SUM:
+                printf("%d\n", sumNodes(root));
+                break;
+            case OP_PATH:
+                showPath(root, num);
+                break;
+            default:
+                break;
+        }
+        recordLatency(&stats[op], nowNs() - start);
+
+        // Recorded outside the timed section so the trace doesn't skew the latency
+        if (op == OP_INSERT) {
+            recordOperation(TRACE_INSERT, num, 0);
+        } else if (op == OP_DELETE) {
+            recordOperation(TRACE_DELETE, num, 0);
+        } else if (op == OP_SEARCH || op == OP_PATH) {
+            recordOperation(TRACE_SEARCH, num, 0);
+        } else {
+            recordOperation(TRACE_RANGE, INT_MIN, INT_MAX);
+        }
+    }
+
+    unsigned long long batchNs = nowNs() - batchStart;
+    fflush(stdout);
+
+    unsigned long long totalOps = 0;
+    fprintf(stderr, "\n--- BATCH LATENCY (ns) ---\n");
+    fprintf(stderr, "%-8s %12s %12s %12s %12s\n", "op", "count", "avg", "min", "max");
+    for (int op = 0; op < OP_TOTAL; op++) {
+        if (stats[op].count == 0) {
+            continue;
+        }
+        totalOps += stats[op].count;
+        fprintf(stderr, "%-8s %12llu %12llu %12llu %12llu\n", batchOperationNames[op],
+                stats[op].count, stats[op].totalNs / stats[op].count, stats[op].minNs, stats[op].maxNs);
+    }
+    if (batchNs > 0) {
+        fprintf(stderr, "Total: %llu operation(s) in %.3f s (%.0f ops/s)\n",
+                totalOps, batchNs / 1e9, totalOps / (batchNs / 1e9));
+    }
+
+    freeTree(root);
+    return errors;
+}
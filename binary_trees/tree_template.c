@@ -1,3 +1,4 @@
+#include <limits.h>
 #include "tree_template.h"
 
 // === Function to create a new Node ===
@@ -19,6 +20,85 @@ Node* createNode(int data)
     return newNode;
 }
 
+// === Node storage ===
+
+// Bloco contíguo de nós (usado pela compactação). A memória do bloco só é
+// devolvida quando ele foi selado e todos os seus nós já foram liberados.
+struct NodeBlock
+{
+    Node* base;
+    size_t capacity;
+    size_t used;
+    size_t live;
+    int sealed;
+    struct NodeBlock* next;
+};
+
+static NodeBlock* nodeBlocks = NULL;
+
+NodeBlock* createNodeBlock(size_t capacity)
+{
+    NodeBlock* block = (NodeBlock*)malloc(sizeof(NodeBlock));
+    Node* base = (Node*)malloc(sizeof(Node) * (capacity > 0 ? capacity : 1));
+
+    if(block == NULL || base == NULL)
+    {
+        printf("Wasn't possible create a new Node block due lacking of memory.");
+        exit(1);
+    }
+
+    block->base = base;
+    block->capacity = capacity;
+    block->used = 0;
+    block->live = 0;
+    block->sealed = 0;
+    block->next = nodeBlocks;
+    nodeBlocks = block;
+
+    return block;
+}
+
+Node* takeNodeFromBlock(NodeBlock* block)
+{
+    if(block->sealed || block->used == block->capacity) return NULL;
+
+    block->live++;
+    return &block->base[block->used++];
+}
+
+// Remove o bloco da lista e devolve sua memória
+static void destroyNodeBlock(NodeBlock* block)
+{
+    NodeBlock** link = &nodeBlocks;
+    while(*link != block) link = &(*link)->next;
+    *link = block->next;
+
+    free(block->base);
+    free(block);
+}
+
+void sealNodeBlock(NodeBlock* block)
+{
+    block->sealed = 1;
+    if(block->live == 0) destroyNodeBlock(block);
+}
+
+void releaseNode(Node* node)
+{
+    for(NodeBlock* block = nodeBlocks; block != NULL; block = block->next)
+    {
+        if(node >= block->base && node < block->base + block->capacity)
+        {
+            block->live--;
+            if(block->sealed && block->live == 0) destroyNodeBlock(block);
+            return;
+        }
+    }
+
+    // Nó comum, criado pelo createNode
+    free(node);
+}
+
 //=== Functions to walk trhought tree ===
 void inOrderTraversal(Node* root)
 {
@@ -50,6 +130,141 @@ void postOrderTraversal(Node* root)
     }
 }
 
+// === Morris Traversals ===
+
+// Predecessor em ordem de `node` dentro da subárvore esquerda, parando na thread
+static Node* threadPredecessor(Node* node)
+{
+    Node* pred = node->left;
+    while(pred->right != NULL && pred->right != node) pred = pred->right;
+    return pred;
+}
+
+void inOrderTraversalMorris(Node* root)
+{
+    Node* current = root;
+
+    while(current != NULL)
+    {
+        if(current->left == NULL)
+        {
+            printf("%d ", current->data);
+            current = current->right;
+            continue;
+        }
+
+        Node* pred = threadPredecessor(current);
+        if(pred->right == NULL)
+        {
+            // Primeira visita: cria a thread de volta e desce à esquerda
+            pred->right = current;
+            current = current->left;
+        }
+        else
+        {
+            // Segunda visita: a esquerda acabou, desfaz a thread
+            pred->right = NULL;
+            printf("%d ", current->data);
+            current = current->right;
+        }
+    }
+}
+
+void preOrderTraversalMorris(Node* root)
+{
+    Node* current = root;
+
+    while(current != NULL)
+    {
+        if(current->left == NULL)
+        {
+            printf("%d ", current->data);
+            current = current->right;
+            continue;
+        }
+
+        Node* pred = threadPredecessor(current);
+        if(pred->right == NULL)
+        {
+            printf("%d ", current->data);
+            pred->right = current;
+            current = current->left;
+        }
+        else
+        {
+            pred->right = NULL;
+            current = current->right;
+        }
+    }
+}
+
+// Inverte a cadeia de ponteiros right de `from` até `to`
+static void reverseRightChain(Node* from, Node* to)
+{
+    if(from == to) return;
+
+    Node* previous = from;
+    Node* current = from->right;
+
+    while(previous != to)
+    {
+        Node* next = current->right;
+        current->right = previous;
+        previous = current;
+        current = next;
+    }
+}
+
+// Imprime de `to` até `from` subindo pela cadeia right (invertida e restaurada)
+static void printRightChainReversed(Node* from, Node* to)
+{
+    reverseRightChain(from, to);
+
+    for(Node* node = to; ; node = node->right)
+    {
+        printf("%d ", node->data);
+        if(node == from) break;
+    }
+
+    reverseRightChain(to, from);
+}
+
+void postOrderTraversalMorris(Node* root)
+{
+    if(root == NULL) return;
+
+    // Raiz falsa: a árvore inteira vira a subárvore esquerda dela
+    Node dummy;
+    dummy.left = root;
+    dummy.right = NULL;
+
+    Node* current = &dummy;
+
+    while(current != NULL)
+    {
+        if(current->left == NULL)
+        {
+            current = current->right;
+            continue;
+        }
+
+        Node* pred = threadPredecessor(current);
+        if(pred->right == NULL)
+        {
+            pred->right = current;
+            current = current->left;
+        }
+        else
+        {
+            // A esquerda acabou: imprime a borda direita dela de baixo para cima.
+            // A thread só é desfeita depois, pois a reinversão deixa pred->right sujo
+            printRightChainReversed(current->left, pred);
+            pred->right = NULL;
+            current = current->right;
+        }
+    }
+}
+
 // === Mainly Functions ===
 
 Node* insert(Node* root, int data)
@@ -83,9 +298,68 @@ Node* search(Node* root, int data)
     }
 
     // Se o valor for menor que o da raiz, busca na subárvore esquerda
-    if(data < root->data) 
+    return search(root->left, data);
+}
+
+// Quantidade de buscas em andamento ao mesmo tempo no searchBatch
+#define SEARCH_BATCH_LANES 16
+
+#if defined(__GNUC__)
+#define PREFETCH_NODE(node) __builtin_prefetch((node), 0, 1)
+#else
+#define PREFETCH_NODE(node) ((void)(node))
+#endif
+
+void searchBatch(Node* root, const int keys[], size_t n, Node* out[])
+{
+    Node* lane[SEARCH_BATCH_LANES];
+    size_t slot[SEARCH_BATCH_LANES];
+    size_t next = 0;
+    int live = 0;
+
+    // Preenche as faixas iniciais (todas começam na raiz, que já está em cache)
+    while(live < SEARCH_BATCH_LANES && next < n)
+    {
+        lane[live] = root;
+        slot[live] = next++;
+        live++;
+    }
+
+    while(live > 0)
     {
-        return search(root->left, data);
+        // Cada passada desce um nível em todas as buscas; o prefetch de uma faixa
+        // tem o tempo das outras faixas para chegar antes de ser usado.
+        for(int i = 0; i < live; )
+        {
+            Node* current = lane[i];
+            int key = keys[slot[i]];
+
+            if(current == NULL || current->data == key)
+            {
+                out[slot[i]] = current;
+
+                if(next < n)
+                {
+                    // Reaproveita a faixa com a próxima chave
+                    lane[i] = root;
+                    slot[i] = next++;
+                    i++;
+                }
+                else
+                {
+                    // Sem chaves restantes: compacta as faixas ativas
+                    live--;
+                    lane[i] = lane[live];
+                    slot[i] = slot[live];
+                }
+                continue;
+            }
+
+            current = (key < current->data) ? current->left : current->right;
+            if(current != NULL) PREFETCH_NODE(current);
+            lane[i] = current;
+            i++;
+        }
     }
 }
 
@@ -113,6 +387,204 @@ Node* findMaxValue(Node* node)
     return current;
 }
 
+// === Nearest-key queries ===
+
+Node* findFloor(Node* root, int data)
+{
+    Node* best = NULL;
+
+    while(root != NULL)
+    {
+        if(root->data == data) return root;
+
+        if(root->data < data)
+        {
+            // Candidato; um maior (ainda <= data) só pode estar à direita
+            best = root;
+            root = root->right;
+        }
+        else
+        {
+            root = root->left;
+        }
+    }
+
+    return best;
+}
+
+Node* findCeiling(Node* root, int data)
+{
+    Node* best = NULL;
+
+    while(root != NULL)
+    {
+        if(root->data == data) return root;
+
+        if(root->data > data)
+        {
+            best = root;
+            root = root->left;
+        }
+        else
+        {
+            root = root->right;
+        }
+    }
+
+    return best;
+}
+
+Node* findPredecessor(Node* root, int data)
+{
+    Node* best = NULL;
+
+    while(root != NULL)
+    {
+        if(root->data < data)
+        {
+            best = root;
+            root = root->right;
+        }
+        else
+        {
+            root = root->left;
+        }
+    }
+
+    return best;
+}
+
+Node* findSuccessor(Node* root, int data)
+{
+    Node* best = NULL;
+
+    while(root != NULL)
+    {
+        if(root->data > data)
+        {
+            best = root;
+            root = root->left;
+        }
+        else
+        {
+            root = root->right;
+        }
+    }
+
+    return best;
+}
+
+// Profundidade máxima guardada no finger; numa BST mais funda que isso o
+// caminho só deixa de ser reaproveitado abaixo desse nível
+#define NEAREST_FINGER_DEPTH 64
+
+typedef enum { NEAREST_FLOOR, NEAREST_CEILING, NEAREST_PREDECESSOR, NEAREST_SUCCESSOR } NearestMode;
+
+// Um nível do caminho: o nó e os ancestrais mais próximos menor (low) e maior (high)
+// que limitam as chaves da sua subárvore
+typedef struct
+{
+    Node* node;
+    Node* low;
+    Node* high;
+} NearestFinger;
+
+// Se a descida para `data` vai à direita de um nó com a chave `key`
+static int goesRight(NearestMode mode, int key, int data)
+{
+    return mode == NEAREST_SUCCESSOR ? key <= data : key < data;
+}
+
+// Se a descida para `data` vai à esquerda (floor e ceiling param na igualdade)
+static int goesLeft(NearestMode mode, int key, int data)
+{
+    return mode == NEAREST_PREDECESSOR ? key >= data : key > data;
+}
+
+static void nearestBatch(Node* root, const int keys[], size_t n, Node* out[], NearestMode mode)
+{
+    NearestFinger path[NEAREST_FINGER_DEPTH];
+    int depth = 1;
+
+    path[0].node = root;
+    path[0].low = NULL;
+    path[0].high = NULL;
+
+    for(size_t i = 0; i < n; i++)
+    {
+        int data = keys[i];
+
+        // Sobe até a subárvore cuja faixa de chaves contém data (a raiz sempre contém)
+        while(depth > 1)
+        {
+            NearestFinger* top = &path[depth - 1];
+            if((top->low == NULL || goesRight(mode, top->low->data, data))
+               && (top->high == NULL || goesLeft(mode, top->high->data, data))) break;
+            depth--;
+        }
+
+        Node* current = path[depth - 1].node;
+        Node* low = path[depth - 1].low;
+        Node* high = path[depth - 1].high;
+        Node* exact = NULL;
+
+        while(current != NULL)
+        {
+            if(goesRight(mode, current->data, data))
+            {
+                low = current;
+                current = current->right;
+            }
+            else if(goesLeft(mode, current->data, data))
+            {
+                high = current;
+                current = current->left;
+            }
+            else
+            {
+                // Igualdade em floor/ceiling: o próprio nó é a resposta
+                exact = current;
+                break;
+            }
+
+            if(current != NULL && depth < NEAREST_FINGER_DEPTH)
+            {
+                path[depth].node = current;
+                path[depth].low = low;
+                path[depth].high = high;
+                depth++;
+            }
+        }
+
+        if(exact != NULL)
+            out[i] = exact;
+        else if(mode == NEAREST_FLOOR || mode == NEAREST_PREDECESSOR)
+            out[i] = low;
+        else
+            out[i] = high;
+    }
+}
+
+void findFloorBatch(Node* root, const int keys[], size_t n, Node* out[])
+{
+    nearestBatch(root, keys, n, out, NEAREST_FLOOR);
+}
+
+void findCeilingBatch(Node* root, const int keys[], size_t n, Node* out[])
+{
+    nearestBatch(root, keys, n, out, NEAREST_CEILING);
+}
+
+void findPredecessorBatch(Node* root, const int keys[], size_t n, Node* out[])
+{
+    nearestBatch(root, keys, n, out, NEAREST_PREDECESSOR);
+}
+
+void findSuccessorBatch(Node* root, const int keys[], size_t n, Node* out[])
+{
+    nearestBatch(root, keys, n, out, NEAREST_SUCCESSOR);
+}
+
 Node* deleteNode(Node* root, int data) {
     // Caso base: se a árvore estiver vazia
     if (root == NULL) {
@@ -130,17 +602,17 @@ Node* deleteNode(Node* root, int data) {
         // Caso 1: Nó com apenas um filho ou nenhum filho
         if (root->left == NULL) {
             Node* temp = root->right;
-            free(root);
+            releaseNode(root);
             return temp;
         } else if (root->right == NULL) {
             Node* temp = root->left;
-            free(root);
+            releaseNode(root);
             return temp;
         }
 
         // Caso 2: Nó com dois filhos
         // Pega o sucessor em ordem (menor nó da subárvore direita)
-        Node* temp = findMinValueNode(root->right);
+        Node* temp = findMinValue(root->right);
 
         // Copia o valor do sucessor para este nó
         root->data = temp->data;
@@ -286,7 +758,7 @@ Node* deleteNodeAVL(Node* root, int data)
             }
             else // Um filho
              *root = *temp; // Copia o conteúdo do filho não-vazio
-            free(temp);
+            releaseNode(temp);
         }
         else
         {
@@ -305,27 +777,27 @@ Node* deleteNodeAVL(Node* root, int data)
     root->height = 1 + max(height(root->left), height(root->right));
 
     // 3. Calcula o fator de balanceamento
-    int balance = getBalance(root);
+    int balance = getBalanceFactor(root);
 
     // Se o nó ficou desbalanceado, existem 4 casos:
 
     // Caso Esquerda-Esquerda (LL)
-    if (balance > 1 && getBalance(root->left) >= 0)
+    if (balance > 1 && getBalanceFactor(root->left) >= 0)
         return rightRotate(root);
 
     // Caso Esquerda-Direita (LR)
-    if (balance > 1 && getBalance(root->left) < 0)
+    if (balance > 1 && getBalanceFactor(root->left) < 0)
     {
         root->left =  leftRotate(root->left);
         return rightRotate(root);
     }
 
     // Caso Direita-Direita (RR)
-    if (balance < -1 && getBalance(root->right) <= 0)
+    if (balance < -1 && getBalanceFactor(root->right) <= 0)
         return leftRotate(root);
 
     // Caso Direita-Esquerda (RL)
-    if (balance < -1 && getBalance(root->right) > 0)
+    if (balance < -1 && getBalanceFactor(root->right) > 0)
     {
         root->right = rightRotate(root->right);
         return leftRotate(root);
@@ -334,10 +806,144 @@ Node* deleteNodeAVL(Node* root, int data)
     return root;
 }
 
-void freeTree(Node* root) {
-    if (root != NULL) {
-        freeTree(root->left);
-        freeTree(root->right);
-        free(root);
+// --- SPLIT / JOIN ---
+
+// Rebalanceia um nó cujos filhos diferem em altura no máximo 2 (mesmos casos da remoção)
+static Node* rebalance(Node* root)
+{
+    root->height = 1 + max(height(root->left), height(root->right));
+    int balance = getBalanceFactor(root);
+
+    if (balance > 1)
+    {
+        if (getBalanceFactor(root->left) < 0)
+            root->left = leftRotate(root->left);
+        return rightRotate(root);
+    }
+
+    if (balance < -1)
+    {
+        if (getBalanceFactor(root->right) > 0)
+            root->right = rightRotate(root->right);
+        return leftRotate(root);
+    }
+
+    return root;
+}
+
+Node* joinAVL(Node* left, Node* pivot, Node* right)
+{
+    // Desce pela borda da árvore mais alta até encontrar altura compatível
+    if (height(left) > height(right) + 1)
+    {
+        left->right = joinAVL(left->right, pivot, right);
+        return rebalance(left);
+    }
+
+    if (height(right) > height(left) + 1)
+    {
+        right->left = joinAVL(left, pivot, right->left);
+        return rebalance(right);
+    }
+
+    pivot->left = left;
+    pivot->right = right;
+    pivot->height = 1 + max(height(left), height(right));
+    return pivot;
+}
+
+void split(Node* root, int key, Node** less, Node** greaterOrEqual)
+{
+    if (root == NULL)
+    {
+        *less = NULL;
+        *greaterOrEqual = NULL;
+        return;
+    }
+
+    Node* left = root->left;
+    Node* right = root->right;
+    Node* lower;
+    Node* upper;
+
+    if (root->data < key)
+    {
+        // A raiz e a subárvore esquerda ficam do lado "menor"
+        split(right, key, &lower, &upper);
+        *less = joinAVL(left, root, lower);
+        *greaterOrEqual = upper;
+    }
+    else
+    {
+        split(left, key, &lower, &upper);
+        *less = lower;
+        *greaterOrEqual = joinAVL(upper, root, right);
+    }
+}
+
+// Desliga o menor nó da árvore (sem liberar) e retorna a nova raiz
+static Node* detachMin(Node* root, Node** min)
+{
+    if (root->left == NULL)
+    {
+        *min = root;
+        return root->right;
+    }
+
+    root->left = detachMin(root->left, min);
+    return rebalance(root);
+}
+
+Node* eraseRange(Node* root, int lo, int hi, Node** removed)
+{
+    Node* before;
+    Node* middle;
+    Node* after;
+
+    if (removed != NULL) *removed = NULL;
+    if (lo > hi) return root;
+
+    split(root, lo, &before, &middle);
+    if (hi == INT_MAX)
+    {
+        after = NULL;
+    }
+    else
+    {
+        Node* rest = middle;
+        split(rest, hi + 1, &middle, &after);
+    }
+
+    if (removed != NULL)
+        *removed = middle;
+    else
+        freeTree(middle);
+
+    // Junta o que sobrou usando o menor nó da direita como pivô
+    if (after == NULL) return before;
+
+    Node* pivot;
+    after = detachMin(after, &pivot);
+    return joinAVL(before, pivot, after);
+}
+
+void freeTree(Node* root)
+{
+    while(root != NULL)
+    {
+        if(root->left != NULL)
+        {
+            // Rotação à direita: o filho esquerdo sobe e a raiz vai para a espinha direita
+            Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        }
+        else
+        {
+            Node* next = root->right;
+            releaseNode(root);
+            root = next;
+        }
     }
 }
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include <stdio.h>
 
 // Define the structure for a binary tree node
-typedef struct 
+typedef struct Node
 {
     int data;
     struct Node* left;
@@ -20,6 +20,39 @@ typedef struct
  */
 Node* createNode(int data);
 
+// === Node storage ===
+
+// Contiguous block of Nodes, used to lay a tree out in memory (see tree_layout.h)
+typedef struct NodeBlock NodeBlock;
+
+/**
+ * @brief Allocates a contiguous block with room for `capacity` Nodes.
+ * @param capacity The number of Nodes in the block.
+ * @return A pointer to the new block.
+ */
+NodeBlock* createNodeBlock(size_t capacity);
+
+/**
+ * @brief Hands out the next free Node of a block.
+ * @param block A pointer to the block.
+ * @return A pointer to an uninitialized Node, or NULL if the block is full or sealed.
+ */
+Node* takeNodeFromBlock(NodeBlock* block);
+
+/**
+ * @brief Marks a block as finished: its memory is returned once all its Nodes are released.
+ * @param block A pointer to the block.
+ */
+void sealNodeBlock(NodeBlock* block);
+
+/**
+ * @brief Frees a single Node, whether it came from createNode or from a NodeBlock.
+ * @param node A pointer to the Node to be freed.
+ * @note Every function of this template frees Nodes through here, so trees stay
+ *       fully mutable after being relocated into a block.
+ */
+void releaseNode(Node* node);
+
 /**
  * @brief Performs an in-order traversal of the binary tree: Left->Root->Right.
  * @param root A pointer to the root of the binary tree.
@@ -39,6 +72,30 @@ void preOrderTraversal(Node* root);
  */
 void postOrderTraversal(Node* root);
 
+// === Constant-memory traversals ===
+// Morris threading: each Node's in-order predecessor temporarily points back to it
+// through its empty right pointer, so no stack is used and any depth works. The tree
+// is restored by the time the function returns, but it must not be touched meanwhile.
+
+/**
+ * @brief In-order traversal (Left->Root->Right) with O(1) extra memory.
+ * @param root A pointer to the root of the binary tree.
+ */
+void inOrderTraversalMorris(Node* root);
+
+/**
+ * @brief Pre-order traversal (Root->Left->Right) with O(1) extra memory.
+ * @param root A pointer to the root of the binary tree.
+ */
+void preOrderTraversalMorris(Node* root);
+
+/**
+ * @brief Post-order traversal (Left->Right->Root) with O(1) extra memory.
+ * Each right edge chain is reversed in place to be printed bottom-up, then restored.
+ * @param root A pointer to the root of the binary tree.
+ */
+void postOrderTraversalMorris(Node* root);
+
 // === Manly tree functions ===
 
 /**
@@ -57,6 +114,17 @@ Node* insert(Node* root, int data);
  */
 Node *search(Node* root, int data);
 
+/**
+ * @brief Searches many keys at once, interleaving the lookups to hide cache misses.
+ * Each pass advances every pending lookup by one level and prefetches the next Node,
+ * so the memory accesses of different keys overlap instead of stalling one by one.
+ * @param root A pointer to the root of the binary tree.
+ * @param keys The keys to be searched for.
+ * @param n The number of keys.
+ * @param out Receives, for each key, the found Node or NULL (same order as keys).
+ */
+void searchBatch(Node* root, const int keys[], size_t n, Node* out[]);
+
 /**
  * @brief Finds the minimum value Node in the binary tree.
  * @param root A pointer to the root of the binary tree.
@@ -71,13 +139,90 @@ Node* findMinValue(Node* node);
  */
 Node* findMaxValue(Node* node);
 
+// === Nearest-key queries ===
+// Each one is a single iterative walk from the root, O(h) (O(log n) on an AVL tree).
+
+/**
+ * @brief Finds the largest key <= data.
+ * @param root A pointer to the root of the binary tree.
+ * @param data The reference key (does not need to be present).
+ * @return A pointer to the found Node, or NULL if every key is greater than data.
+ */
+Node* findFloor(Node* root, int data);
+
+/**
+ * @brief Finds the smallest key >= data.
+ * @param root A pointer to the root of the binary tree.
+ * @param data The reference key (does not need to be present).
+ * @return A pointer to the found Node, or NULL if every key is smaller than data.
+ */
+Node* findCeiling(Node* root, int data);
+
+/**
+ * @brief Finds the largest key strictly smaller than data.
+ * @param root A pointer to the root of the binary tree.
+ * @param data The reference key (does not need to be present).
+ * @return A pointer to the found Node, or NULL if there is none.
+ */
+Node* findPredecessor(Node* root, int data);
+
+/**
+ * @brief Finds the smallest key strictly greater than data.
+ * @param root A pointer to the root of the binary tree.
+ * @param data The reference key (does not need to be present).
+ * @return A pointer to the found Node, or NULL if there is none.
+ */
+Node* findSuccessor(Node* root, int data);
+
+// Batched forms: the path of the previous query is kept as a finger, and each query
+// only climbs back to the deepest Node whose key range still contains it before
+// walking down. Any order is accepted; sorted keys make consecutive queries share
+// most of the path, so a whole sweep costs about O(n + k) instead of O(k log n).
+// The results are written to out[i] in the same order as keys[i].
+
+/**
+ * @brief findFloor for many keys, reusing the previous position.
+ * @param root A pointer to the root of the binary tree.
+ * @param keys The reference keys (preferably sorted).
+ * @param n The number of keys.
+ * @param out Receives, for each key, the found Node or NULL.
+ */
+void findFloorBatch(Node* root, const int keys[], size_t n, Node* out[]);
+
+/**
+ * @brief findCeiling for many keys, reusing the previous position.
+ * @param root A pointer to the root of the binary tree.
+ * @param keys The reference keys (preferably sorted).
+ * @param n The number of keys.
+ * @param out Receives, for each key, the found Node or NULL.
+ */
+void findCeilingBatch(Node* root, const int keys[], size_t n, Node* out[]);
+
+/**
+ * @brief findPredecessor for many keys, reusing the previous position.
+ * @param root A pointer to the root of the binary tree.
+ * @param keys The reference keys (preferably sorted).
+ * @param n The number of keys.
+ * @param out Receives, for each key, the found Node or NULL.
+ */
+void findPredecessorBatch(Node* root, const int keys[], size_t n, Node* out[]);
+
+/**
+ * @brief findSuccessor for many keys, reusing the previous position.
+ * @param root A pointer to the root of the binary tree.
+ * @param keys The reference keys (preferably sorted).
+ * @param n The number of keys.
+ * @param out Receives, for each key, the found Node or NULL.
+ */
+void findSuccessorBatch(Node* root, const int keys[], size_t n, Node* out[]);
+
 /**
  * @brief Deletes a Node with the specified data from the binary tree.
  * @param root A pointer to the root of the binary tree.
  * @param data The data of the Node to be deleted.
  * @return A pointer to the root of the modified binary tree.
  */
-Node* delete(Node* root, int data);
+Node* deleteNode(Node* root, int data);
 
 /*
    ============================================================
@@ -150,4 +295,43 @@ Node* insertAVL(Node* node, int data);
  * @param data The data of the Node to be deleted.
  * @return A pointer to the root of the modified AVL tree.
  */
-Node* deleteAVL(Node* root, int data);
\ No newline at end of file
+Node* deleteNodeAVL(Node* root, int data);
+
+// --- Split / Join ---
+
+/**
+ * @brief Joins two AVL trees around a pivot Node in O(|height(left) - height(right)|).
+ * @param left An AVL tree whose keys are all smaller than pivot->data.
+ * @param pivot A detached Node (its children are overwritten).
+ * @param right An AVL tree whose keys are all greater than pivot->data.
+ * @return A pointer to the root of the joined AVL tree.
+ */
+Node* joinAVL(Node* left, Node* pivot, Node* right);
+
+/**
+ * @brief Splits an AVL tree by key in O(log n). No Node is allocated or freed.
+ * @param root A pointer to the root of the AVL tree (consumed).
+ * @param key The split key.
+ * @param less Receives a balanced tree with the keys < key.
+ * @param greaterOrEqual Receives a balanced tree with the keys >= key.
+ */
+void split(Node* root, int key, Node** less, Node** greaterOrEqual);
+
+/**
+ * @brief Removes every key in [lo, hi] from the AVL tree in O(log n) plus the freeing cost.
+ * @param root A pointer to the root of the AVL tree.
+ * @param lo The lower bound (inclusive).
+ * @param hi The upper bound (inclusive).
+ * @param removed If not NULL, receives the removed keys as a balanced tree so the caller can
+ *                free it later (freeTree) outside the latency-critical path; if NULL they are freed now.
+ * @return A pointer to the root of the modified AVL tree.
+ */
+Node* eraseRange(Node* root, int lo, int hi, Node** removed);
+
+/**
+ * @brief Frees every Node of the tree with O(1) extra memory.
+ * Right rotations flatten the tree into a right spine that is released while it is
+ * walked, so degenerate trees of any depth are freed without recursion.
+ * @param root A pointer to the root of the tree.
+ */
+void freeTree(Node* root);
@@ -0,0 +1,182 @@
+#include <stdint.h>
+#include <string.h>
+#include "tree_trace.h"
+
+static const unsigned char traceMagic[4] = { 'B', 'T', 'T', 'R' };
+
+// === Varint encoding ===
+
+static void writeVarint(FILE* file, uint64_t value)
+{
+    // 7 bits por byte; o bit alto indica que há mais bytes
+    while(value >= 0x80)
+    {
+        putc((int)(value & 0x7f) | 0x80, file);
+        value >>= 7;
+    }
+    putc((int)value, file);
+}
+
+// Retorna 1 se leu, 0 no fim do arquivo antes do primeiro byte, -1 se truncado
+static int readVarint(FILE* file, uint64_t* value)
+{
+    uint64_t result = 0;
+
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        int byte = getc(file);
+        if(byte == EOF) return shift == 0 ? 0 : -1;
+
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if((byte & 0x80) == 0)
+        {
+            *value = result;
+            return 1;
+        }
+    }
+
+    return -1;
+}
+
+// Zigzag: diferenças pequenas (positivas ou negativas) viram números pequenos
+static uint64_t zigzag(int64_t value)   { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+static int64_t unzigzag(uint64_t value) { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+
+// === Writer ===
+
+int traceWriterOpen(TraceWriter* writer, const char* path)
+{
+    unsigned char header[8] = { 0 };
+
+    writer->file = fopen(path, "wb");
+    writer->lastKey = 0;
+    writer->records = 0;
+    if(writer->file == NULL) return 0;
+
+    memcpy(header, traceMagic, sizeof(traceMagic));
+    header[4] = TRACE_VERSION;
+    fwrite(header, 1, sizeof(header), writer->file);
+    return 1;
+}
+
+void traceWrite(TraceWriter* writer, TraceOp op, int a, int b)
+{
+    if(writer->file == NULL) return;
+
+    if(op == TRACE_RANGE && b < a)
+    {
+        int temp = a;
+        a = b;
+        b = temp;
+    }
+
+    putc((int)op, writer->file);
+    writeVarint(writer->file, zigzag((int64_t)a - writer->lastKey));
+    if(op == TRACE_RANGE) writeVarint(writer->file, (uint64_t)((int64_t)b - a));
+
+    writer->lastKey = a;
+    writer->records++;
+}
+
+void traceWriterClose(TraceWriter* writer)
+{
+    if(writer->file != NULL) fclose(writer->file);
+    writer->file = NULL;
+}
+
+// === Reader ===
+
+int traceReaderOpen(TraceReader* reader, const char* path)
+{
+    unsigned char header[8];
+
+    reader->lastKey = 0;
+    reader->file = fopen(path, "rb");
+    if(reader->file == NULL) return 0;
+
+    if(fread(header, 1, sizeof(header), reader->file) != sizeof(header)
+       || memcmp(header, traceMagic, sizeof(traceMagic)) != 0
+       || header[4] != TRACE_VERSION)
+    {
+        fclose(reader->file);
+        reader->file = NULL;
+        return 0;
+    }
+
+    return 1;
+}
+
+int traceRead(TraceReader* reader, TraceRecord* record)
+{
+    uint64_t delta;
+    uint64_t width;
+
+    int op = getc(reader->file);
+    if(op == EOF) return 0;
+    if(op < TRACE_INSERT || op > TRACE_RANGE) return -1;
+
+    if(readVarint(reader->file, &delta) != 1) return -1;
+
+    int64_t key = (int64_t)reader->lastKey + unzigzag(delta);
+    if(key < INT32_MIN || key > INT32_MAX) return -1;
+
+    record->op = (TraceOp)op;
+    record->a = (int)key;
+    record->b = (int)key;
+
+    if(op == TRACE_RANGE)
+    {
+        if(readVarint(reader->file, &width) != 1 || key + (int64_t)width > INT32_MAX) return -1;
+        record->b = (int)(key + (int64_t)width);
+    }
+
+    reader->lastKey = record->a;
+    return 1;
+}
+
+void traceReaderClose(TraceReader* reader)
+{
+    if(reader->file != NULL) fclose(reader->file);
+    reader->file = NULL;
+}
+
+TraceRecord* traceLoad(const char* path, size_t* count)
+{
+    TraceReader reader;
+    TraceRecord* records = NULL;
+    size_t capacity = 0;
+    int status;
+
+    *count = 0;
+    if(!traceReaderOpen(&reader, path)) return NULL;
+
+    while(1)
+    {
+        if(*count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 4096;
+            TraceRecord* grown = (TraceRecord*)realloc(records, sizeof(TraceRecord) * capacity);
+            if(grown == NULL)
+            {
+                printf("Wasn't possible load the trace due lacking of memory.");
+                exit(1);
+            }
+            records = grown;
+        }
+
+        status = traceRead(&reader, &records[*count]);
+        if(status != 1) break;
+        (*count)++;
+    }
+
+    traceReaderClose(&reader);
+
+    if(status < 0)
+    {
+        free(records);
+        *count = 0;
+        return NULL;
+    }
+
+    return records;
+}
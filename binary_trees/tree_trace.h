@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Compact binary trace of tree operations, used to record a real workload and
+// replay it later (see trace_replay.c).
+//
+// Layout: an 8-byte header ("BTTR", version byte, 3 zero bytes) followed by the
+// records. Each record is one op byte and the key as a zigzag varint of its
+// difference to the previous key, so clustered workloads take 2-3 bytes per
+// operation. TRACE_RANGE adds the width (hi - lo) as an unsigned varint.
+
+#define TRACE_VERSION 1
+
+typedef enum
+{
+    TRACE_INSERT = 1,
+    TRACE_SEARCH = 2,
+    TRACE_DELETE = 3,
+    TRACE_RANGE  = 4  // Counts the keys in [a, b]
+} TraceOp;
+
+typedef struct
+{
+    TraceOp op;
+    int a;
+    int b;  // Only used by TRACE_RANGE
+} TraceRecord;
+
+typedef struct
+{
+    FILE* file;
+    int lastKey;
+    size_t records;
+} TraceWriter;
+
+typedef struct
+{
+    FILE* file;
+    int lastKey;
+} TraceReader;
+
+/**
+ * @brief Creates (or truncates) a trace file and writes its header.
+ * @param writer A pointer to the writer to be initialized.
+ * @param path The path of the trace file.
+ * @return 1 on success, 0 if the file could not be created.
+ */
+int traceWriterOpen(TraceWriter* writer, const char* path);
+
+/**
+ * @brief Appends one operation to the trace.
+ * @param writer A pointer to an open writer.
+ * @param op The operation.
+ * @param a The key (or the lower bound for TRACE_RANGE).
+ * @param b The upper bound for TRACE_RANGE (ignored otherwise).
+ */
+void traceWrite(TraceWriter* writer, TraceOp op, int a, int b);
+
+/**
+ * @brief Flushes and closes the trace file.
+ * @param writer A pointer to an open writer.
+ */
+void traceWriterClose(TraceWriter* writer);
+
+/**
+ * @brief Opens a trace file and checks its header.
+ * @param reader A pointer to the reader to be initialized.
+ * @param path The path of the trace file.
+ * @return 1 on success, 0 if the file is missing or is not a trace.
+ */
+int traceReaderOpen(TraceReader* reader, const char* path);
+
+/**
+ * @brief Reads the next record.
+ * @param reader A pointer to an open reader.
+ * @param record Receives the record.
+ * @return 1 if a record was read, 0 at the end of the trace, -1 if the trace is corrupt.
+ */
+int traceRead(TraceReader* reader, TraceRecord* record);
+
+/**
+ * @brief Closes the trace file.
+ * @param reader A pointer to an open reader.
+ */
+void traceReaderClose(TraceReader* reader);
+
+/**
+ * @brief Reads a whole trace into memory, so it can be replayed without I/O.
+ * @param path The path of the trace file.
+ * @param count Receives the number of records.
+ * @return A malloc'ed array of records (free it with free), or NULL on error.
+ */
+TraceRecord* traceLoad(const char* path, size_t* count);
@@ -0,0 +1,149 @@
+/*
+Benchmark do conjunto van Emde Boas (veb_set.c) contra a AVL do tree_template.
+
+Para chaves densas (0..n-1 embaralhadas) e esparsas (aleatórias em 32 bits)
+mede inserção, busca, sucessor, predecessor e remoção nas duas estruturas.
+
+Compilar: gcc -O2 veb_benchmark.c veb_set.c tree_template.c -o veb_benchmark
+Uso:      ./veb_benchmark [chaves] [consultas]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "tree_template.h"
+#include "veb_set.h"
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int rngState = 88172645u;
+static unsigned int nextRandom(void)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void shuffle(int* keys, int n)
+{
+    for(int i = n - 1; i > 0; i--)
+    {
+        int j = (int)(nextRandom() % (unsigned int)(i + 1));
+        int temp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = temp;
+    }
+}
+
+static void printRow(const char* operation, double avlSeconds, double vebSeconds, int count)
+{
+    printf("  %-12s AVL %8.1f ns   vEB %8.1f ns   (%.1fx)\n", operation,
+           avlSeconds * 1e9 / count, vebSeconds * 1e9 / count, avlSeconds / vebSeconds);
+}
+
+static void runScenario(const char* name, int* keys, int n, const int* queries, int q)
+{
+    Node* root = NULL;
+    VebSet set;
+    long long checksum = 0;
+    int out;
+
+    vebInit(&set);
+    printf("\n%s (%d chaves, %d consultas)\n", name, n, q);
+
+    double t = nowSeconds();
+    for(int i = 0; i < n; i++) root = insertAVL(root, keys[i]);
+    double avl = nowSeconds() - t;
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) vebInsert(&set, keys[i]);
+    printRow("insert", avl, nowSeconds() - t, n);
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++) checksum += search(root, queries[i]) != NULL;
+    avl = nowSeconds() - t;
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++) checksum -= vebMember(&set, queries[i]);
+    printRow("member", avl, nowSeconds() - t, q);
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++)
+    {
+        Node* found = findSuccessor(root, queries[i]);
+        if(found) checksum += found->data;
+    }
+    avl = nowSeconds() - t;
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++)
+    {
+        if(vebSuccessor(&set, queries[i], &out)) checksum -= out;
+    }
+    printRow("successor", avl, nowSeconds() - t, q);
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++)
+    {
+        Node* found = findPredecessor(root, queries[i]);
+        if(found) checksum += found->data;
+    }
+    avl = nowSeconds() - t;
+
+    t = nowSeconds();
+    for(int i = 0; i < q; i++)
+    {
+        if(vebPredecessor(&set, queries[i], &out)) checksum -= out;
+    }
+    printRow("predecessor", avl, nowSeconds() - t, q);
+
+    shuffle(keys, n);
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) root = deleteNodeAVL(root, keys[i]);
+    avl = nowSeconds() - t;
+
+    t = nowSeconds();
+    for(int i = 0; i < n; i++) vebDelete(&set, keys[i]);
+    printRow("delete", avl, nowSeconds() - t, n);
+
+    // As duas estruturas devem ter dado as mesmas respostas
+    if(checksum != 0) printf("  ERRO: resultados diferentes (checksum %lld)\n", checksum);
+
+    freeTree(root);
+    vebFree(&set);
+}
+
+int main(int argc, char* argv[])
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int q = (argc > 2) ? atoi(argv[2]) : 2000000;
+
+    int* keys = (int*)malloc(sizeof(int) * n);
+    int* queries = (int*)malloc(sizeof(int) * q);
+    if(keys == NULL || queries == NULL)
+    {
+        printf("Memória insuficiente.\n");
+        return 1;
+    }
+
+    // Densas: 0..n-1 em ordem aleatória; consultas no mesmo intervalo
+    for(int i = 0; i < n; i++) keys[i] = i;
+    shuffle(keys, n);
+    for(int i = 0; i < q; i++) queries[i] = (int)(nextRandom() % (unsigned int)n);
+    runScenario("Chaves densas", keys, n, queries, q);
+
+    // Esparsas: valores aleatórios no universo de 32 bits (repetidas são ignoradas)
+    for(int i = 0; i < n; i++) keys[i] = (int)nextRandom();
+    for(int i = 0; i < q; i++) queries[i] = (int)nextRandom();
+    runScenario("Chaves esparsas", keys, n, queries, q);
+
+    free(keys);
+    free(queries);
+    return 0;
+}
@@ -0,0 +1,363 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "veb_set.h"
+
+#define VEB_CLUSTERS 65536
+
+// === 256-bit bitmap helpers ===
+
+static int bitmapTest(const uint64_t w[4], int i)
+{
+    return (int)((w[i >> 6] >> (i & 63)) & 1);
+}
+
+static void bitmapSet(uint64_t w[4], int i)
+{
+    w[i >> 6] |= 1ULL << (i & 63);
+}
+
+static void bitmapClear(uint64_t w[4], int i)
+{
+    w[i >> 6] &= ~(1ULL << (i & 63));
+}
+
+static int bitmapEmpty(const uint64_t w[4])
+{
+    return (w[0] | w[1] | w[2] | w[3]) == 0;
+}
+
+// Menor bit ligado >= i, ou -1
+static int bitmapNext(const uint64_t w[4], int i)
+{
+    if(i > 255) return -1;
+
+    int word = i >> 6;
+    uint64_t bits = w[word] & (~0ULL << (i & 63));
+
+    while(bits == 0)
+    {
+        if(++word == 4) return -1;
+        bits = w[word];
+    }
+
+    return (word << 6) + __builtin_ctzll(bits);
+}
+
+// Maior bit ligado <= i, ou -1
+static int bitmapPrev(const uint64_t w[4], int i)
+{
+    if(i < 0) return -1;
+
+    int word = i >> 6;
+    uint64_t bits = w[word] & (~0ULL >> (63 - (i & 63)));
+
+    while(bits == 0)
+    {
+        if(--word < 0) return -1;
+        bits = w[word];
+    }
+
+    return (word << 6) + 63 - __builtin_clzll(bits);
+}
+
+// Quantidade de bits ligados antes de i
+static int bitmapRank(const uint64_t w[4], int i)
+{
+    int rank = 0;
+    int word = i >> 6;
+
+    for(int k = 0; k < word; k++) rank += __builtin_popcountll(w[k]);
+    if(i & 63) rank += __builtin_popcountll(w[word] & (~0ULL >> (64 - (i & 63))));
+
+    return rank;
+}
+
+static void* allocOrDie(size_t bytes)
+{
+    void* memory = calloc(1, bytes);
+
+    if(memory == NULL)
+    {
+        printf("Wasn't possible grow the vEB set due lacking of memory.");
+        exit(1);
+    }
+
+    return memory;
+}
+
+// === Middle level (universe 2^16) ===
+
+static VebLeaf* midLeaf(const VebMid* mid, int high)
+{
+    if(!bitmapTest(mid->summary, high)) return NULL;
+    return mid->leaves[bitmapRank(mid->summary, high)];
+}
+
+static int midInsert(VebMid* mid, int x)
+{
+    int high = x >> 8;
+    int low = x & 255;
+    VebLeaf* leaf = midLeaf(mid, high);
+
+    if(leaf == NULL)
+    {
+        // Nova folha: entra na posição dada pelo posto de `high`
+        if(mid->leafCount == mid->leafCapacity)
+        {
+            int capacity = mid->leafCapacity ? mid->leafCapacity * 2 : 4;
+            VebLeaf** grown = (VebLeaf**)realloc(mid->leaves, sizeof(VebLeaf*) * capacity);
+            if(grown == NULL)
+            {
+                printf("Wasn't possible grow the vEB set due lacking of memory.");
+                exit(1);
+            }
+            mid->leaves = grown;
+            mid->leafCapacity = capacity;
+        }
+
+        int rank = bitmapRank(mid->summary, high);
+        memmove(&mid->leaves[rank + 1], &mid->leaves[rank], sizeof(VebLeaf*) * (mid->leafCount - rank));
+
+        leaf = (VebLeaf*)allocOrDie(sizeof(VebLeaf));
+        mid->leaves[rank] = leaf;
+        mid->leafCount++;
+        bitmapSet(mid->summary, high);
+    }
+
+    if(bitmapTest(leaf->bits, low)) return 0;
+
+    bitmapSet(leaf->bits, low);
+    return 1;
+}
+
+static int midDelete(VebMid* mid, int x)
+{
+    int high = x >> 8;
+    int low = x & 255;
+    VebLeaf* leaf = midLeaf(mid, high);
+
+    if(leaf == NULL || !bitmapTest(leaf->bits, low)) return 0;
+
+    bitmapClear(leaf->bits, low);
+    if(bitmapEmpty(leaf->bits))
+    {
+        int rank = bitmapRank(mid->summary, high);
+        free(leaf);
+        memmove(&mid->leaves[rank], &mid->leaves[rank + 1], sizeof(VebLeaf*) * (mid->leafCount - rank - 1));
+        mid->leafCount--;
+        bitmapClear(mid->summary, high);
+    }
+
+    return 1;
+}
+
+// Menor elemento >= x, ou -1
+static int midNext(const VebMid* mid, int x)
+{
+    int high = x >> 8;
+    VebLeaf* leaf = midLeaf(mid, high);
+
+    if(leaf != NULL)
+    {
+        int low = bitmapNext(leaf->bits, x & 255);
+        if(low >= 0) return (high << 8) | low;
+    }
+
+    high = bitmapNext(mid->summary, high + 1);
+    if(high < 0) return -1;
+
+    return (high << 8) | bitmapNext(midLeaf(mid, high)->bits, 0);
+}
+
+// Maior elemento <= x, ou -1
+static int midPrev(const VebMid* mid, int x)
+{
+    int high = x >> 8;
+    VebLeaf* leaf = midLeaf(mid, high);
+
+    if(leaf != NULL)
+    {
+        int low = bitmapPrev(leaf->bits, x & 255);
+        if(low >= 0) return (high << 8) | low;
+    }
+
+    high = bitmapPrev(mid->summary, high - 1);
+    if(high < 0) return -1;
+
+    return (high << 8) | bitmapPrev(midLeaf(mid, high)->bits, 255);
+}
+
+static void midFree(VebMid* mid)
+{
+    for(int i = 0; i < mid->leafCount; i++) free(mid->leaves[i]);
+    free(mid->leaves);
+}
+
+// === Top level (universe 2^32) ===
+
+// Inverte o bit de sinal: a ordem dos int vira a ordem dos uint32_t
+static uint32_t toUniverse(int key)   { return (uint32_t)key ^ 0x80000000u; }
+static int fromUniverse(uint32_t x)   { return (int)(x ^ 0x80000000u); }
+
+// Menor elemento >= x
+static int topNext(const VebSet* set, uint32_t x, uint32_t* out)
+{
+    int high = (int)(x >> 16);
+    const VebMid* cluster = set->clusters[high];
+
+    if(cluster != NULL)
+    {
+        int low = midNext(cluster, (int)(x & 0xffff));
+        if(low >= 0)
+        {
+            *out = ((uint32_t)high << 16) | (uint32_t)low;
+            return 1;
+        }
+    }
+
+    if(high == VEB_CLUSTERS - 1) return 0;
+    high = midNext(&set->summary, high + 1);
+    if(high < 0) return 0;
+
+    *out = ((uint32_t)high << 16) | (uint32_t)midNext(set->clusters[high], 0);
+    return 1;
+}
+
+// Maior elemento <= x
+static int topPrev(const VebSet* set, uint32_t x, uint32_t* out)
+{
+    int high = (int)(x >> 16);
+    const VebMid* cluster = set->clusters[high];
+
+    if(cluster != NULL)
+    {
+        int low = midPrev(cluster, (int)(x & 0xffff));
+        if(low >= 0)
+        {
+            *out = ((uint32_t)high << 16) | (uint32_t)low;
+            return 1;
+        }
+    }
+
+    if(high == 0) return 0;
+    high = midPrev(&set->summary, high - 1);
+    if(high < 0) return 0;
+
+    *out = ((uint32_t)high << 16) | (uint32_t)midPrev(set->clusters[high], 0xffff);
+    return 1;
+}
+
+// === Public functions ===
+
+void vebInit(VebSet* set)
+{
+    memset(&set->summary, 0, sizeof(set->summary));
+    set->clusters = (VebMid**)allocOrDie(sizeof(VebMid*) * VEB_CLUSTERS);
+    set->size = 0;
+}
+
+int vebInsert(VebSet* set, int key)
+{
+    uint32_t x = toUniverse(key);
+    int high = (int)(x >> 16);
+
+    if(set->clusters[high] == NULL)
+    {
+        set->clusters[high] = (VebMid*)allocOrDie(sizeof(VebMid));
+        midInsert(&set->summary, high);
+    }
+
+    if(!midInsert(set->clusters[high], (int)(x & 0xffff))) return 0;
+
+    set->size++;
+    return 1;
+}
+
+int vebDelete(VebSet* set, int key)
+{
+    uint32_t x = toUniverse(key);
+    int high = (int)(x >> 16);
+    VebMid* cluster = set->clusters[high];
+
+    if(cluster == NULL || !midDelete(cluster, (int)(x & 0xffff))) return 0;
+
+    // Cluster vazio sai da tabela e do resumo
+    if(cluster->leafCount == 0)
+    {
+        midFree(cluster);
+        free(cluster);
+        set->clusters[high] = NULL;
+        midDelete(&set->summary, high);
+    }
+
+    set->size--;
+    return 1;
+}
+
+int vebMember(const VebSet* set, int key)
+{
+    uint32_t x = toUniverse(key);
+    const VebMid* cluster = set->clusters[x >> 16];
+    if(cluster == NULL) return 0;
+
+    const VebLeaf* leaf = midLeaf(cluster, (int)((x >> 8) & 255));
+    return leaf != NULL && bitmapTest(leaf->bits, (int)(x & 255));
+}
+
+int vebSuccessor(const VebSet* set, int key, int* out)
+{
+    uint32_t x = toUniverse(key);
+    uint32_t found;
+
+    if(x == UINT32_MAX || !topNext(set, x + 1, &found)) return 0;
+
+    *out = fromUniverse(found);
+    return 1;
+}
+
+int vebPredecessor(const VebSet* set, int key, int* out)
+{
+    uint32_t x = toUniverse(key);
+    uint32_t found;
+
+    if(x == 0 || !topPrev(set, x - 1, &found)) return 0;
+
+    *out = fromUniverse(found);
+    return 1;
+}
+
+int vebMin(const VebSet* set, int* out)
+{
+    uint32_t found;
+    if(!topNext(set, 0, &found)) return 0;
+
+    *out = fromUniverse(found);
+    return 1;
+}
+
+int vebMax(const VebSet* set, int* out)
+{
+    uint32_t found;
+    if(!topPrev(set, UINT32_MAX, &found)) return 0;
+
+    *out = fromUniverse(found);
+    return 1;
+}
+
+void vebFree(VebSet* set)
+{
+    for(int i = 0; i < VEB_CLUSTERS; i++)
+    {
+        if(set->clusters[i] != NULL)
+        {
+            midFree(set->clusters[i]);
+            free(set->clusters[i]);
+        }
+    }
+
+    midFree(&set->summary);
+    free(set->clusters);
+    set->clusters = NULL;
+    set->size = 0;
+}
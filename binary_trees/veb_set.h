@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Ordered set of int keys over the whole 32-bit universe, laid out as a
+// van Emde Boas tree with a fixed number of levels:
+//   2^32 -> 65536 clusters of 2^16 -> 256 leaves of 2^8 -> 256-bit bitmaps.
+// Every operation touches one node per level, so it costs O(log log U)
+// (three levels) no matter how many keys are stored.
+
+// Bottom level: universe of 2^8 keys
+typedef struct
+{
+    uint64_t bits[4];
+} VebLeaf;
+
+// Middle level: universe of 2^16 keys. Only the leaves in use are allocated,
+// kept in order; the position of a leaf is the rank of its bit in `summary`.
+typedef struct
+{
+    uint64_t summary[4];
+    VebLeaf** leaves;
+    int leafCount;
+    int leafCapacity;
+} VebMid;
+
+// Top level: universe of 2^32 keys
+typedef struct
+{
+    VebMid summary;     // Which clusters are non-empty
+    VebMid** clusters;  // 65536 entries, NULL when the cluster is empty
+    size_t size;
+} VebSet;
+
+/**
+ * @brief Initializes an empty set (allocates the 65536-entry cluster table).
+ * @param set A pointer to the structure to be initialized.
+ */
+void vebInit(VebSet* set);
+
+/**
+ * @brief Inserts a key in O(log log U).
+ * @param set A pointer to the set.
+ * @param key The key to be inserted.
+ * @return 1 if the key was inserted, 0 if it was already present.
+ */
+int vebInsert(VebSet* set, int key);
+
+/**
+ * @brief Deletes a key in O(log log U).
+ * @param set A pointer to the set.
+ * @param key The key to be deleted.
+ * @return 1 if the key was deleted, 0 if it was not present.
+ */
+int vebDelete(VebSet* set, int key);
+
+/**
+ * @brief Checks whether a key is present in O(1).
+ * @param set A pointer to the set.
+ * @param key The key to be checked.
+ * @return 1 if the key is present, 0 otherwise.
+ */
+int vebMember(const VebSet* set, int key);
+
+/**
+ * @brief Finds the smallest key strictly greater than `key` in O(log log U).
+ * @param set A pointer to the set.
+ * @param key The reference key (does not need to be present).
+ * @param out Receives the successor when there is one.
+ * @return 1 if a successor exists, 0 otherwise.
+ */
+int vebSuccessor(const VebSet* set, int key, int* out);
+
+/**
+ * @brief Finds the largest key strictly smaller than `key` in O(log log U).
+ * @param set A pointer to the set.
+ * @param key The reference key (does not need to be present).
+ * @param out Receives the predecessor when there is one.
+ * @return 1 if a predecessor exists, 0 otherwise.
+ */
+int vebPredecessor(const VebSet* set, int key, int* out);
+
+/**
+ * @brief Finds the smallest key of the set.
+ * @param set A pointer to the set.
+ * @param out Receives the minimum when the set is not empty.
+ * @return 1 if the set is not empty, 0 otherwise.
+ */
+int vebMin(const VebSet* set, int* out);
+
+/**
+ * @brief Finds the largest key of the set.
+ * @param set A pointer to the set.
+ * @param out Receives the maximum when the set is not empty.
+ * @return 1 if the set is not empty, 0 otherwise.
+ */
+int vebMax(const VebSet* set, int* out);
+
+/**
+ * @brief Frees every level of the set.
+ * @param set A pointer to the set.
+ * @note Call vebInit again before reusing the structure.
+ */
+void vebFree(VebSet* set);
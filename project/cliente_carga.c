@@ -0,0 +1,215 @@
+// Compilar com: gcc -O2 cliente_carga.c -o cliente_carga
+
+/*
+ * Cliente de carga para o modo servidor do project_plane.
+ *
+ * Abre várias conexões no socket do servidor; cada uma cadastra o seu voo e
+ * depois manda pares "embarcar"/"remover" do mesmo passageiro, mantendo até
+ * <profundidade> requisições em trânsito (pipelining). Como cada par desfaz o
+ * anterior, o teste pode ser repetido contra o mesmo servidor.
+ *
+ * Uso: ./cliente_carga <socket> [conexoes] [requisicoes por conexao] [profundidade]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/**
+ * @brief Estado de uma conexão do cliente de carga.
+ */
+typedef struct {
+    int fd;
+    char idVoo[8];
+    long enviadas;      // Requisições já escritas no buffer de saída
+    long respondidas;
+    double* envio;      // Instante de envio de cada requisição em trânsito (anel)
+    char saida[8192];
+    size_t tamanhoSaida;
+    char entrada[8192];
+    size_t usados;
+    int inicioResposta; // A próxima linha é a de status (OK/ERRO)
+} Conexao;
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compararDouble(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Monta a requisição número n da conexão c: primeiro o voo, depois os pares
+static int montarRequisicao(const Conexao* c, int indice, long n, char* linha, size_t tamanho) {
+    if (n == 0)
+        return snprintf(linha, tamanho, "voo CK-%05d %s GRU CARGA A320 1000\n", indice, c->idVoo);
+    return snprintf(linha, tamanho, "%s %s Passageiro %ld\n",
+                    (n % 2) ? "embarcar" : "remover", c->idVoo, (n - 1) / 2);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <socket> [conexoes] [requisicoes por conexao] [profundidade]\n", argv[0]);
+        return 1;
+    }
+    const char* caminho = argv[1];
+    int total = argc > 2 ? atoi(argv[2]) : 16;
+    long porConexao = argc > 3 ? atol(argv[3]) : 10000;
+    int profundidade = argc > 4 ? atoi(argv[4]) : 32;
+
+    if (total < 1 || total > 99999 || porConexao < 1 || profundidade < 1) {
+        fprintf(stderr, "Parâmetros inválidos.\n");
+        return 1;
+    }
+    porConexao++; // A primeira requisição de cada conexão é o cadastro do voo
+
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        fprintf(stderr, "Caminho do socket muito longo: %s\n", caminho);
+        return 1;
+    }
+    strcpy(endereco.sun_path, caminho);
+
+    Conexao* conexoes = (Conexao*)calloc(total, sizeof(Conexao));
+    struct pollfd* pfds = (struct pollfd*)calloc(total, sizeof(struct pollfd));
+    double* latencias = (double*)malloc(sizeof(double) * total * porConexao);
+    if (conexoes == NULL || pfds == NULL || latencias == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        return 1;
+    }
+
+    for (int i = 0; i < total; i++) {
+        Conexao* c = &conexoes[i];
+        c->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (c->fd < 0 || connect(c->fd, (struct sockaddr*)&endereco, sizeof(endereco)) < 0) {
+            perror("Erro ao conectar");
+            return 1;
+        }
+        fcntl(c->fd, F_SETFL, fcntl(c->fd, F_GETFL, 0) | O_NONBLOCK);
+        snprintf(c->idVoo, sizeof(c->idVoo), "K%05d", i);
+        c->envio = (double*)malloc(sizeof(double) * profundidade);
+        if (c->envio == NULL) {
+            printf("Erro crítico de alocação de memória.\n");
+            return 1;
+        }
+        c->inicioResposta = 1;
+    }
+
+    long respostas = 0, erros = 0, cadastrosRecusados = 0;
+    size_t medidas = 0;
+    int ativas = total;
+    double inicio = agora();
+
+    while (ativas > 0) {
+        for (int i = 0; i < total; i++) {
+            Conexao* c = &conexoes[i];
+            pfds[i].fd = -1;
+            pfds[i].events = 0;
+            if (c->fd < 0) continue;
+
+            // Completa a janela de requisições em trânsito
+            while (c->enviadas < porConexao && c->enviadas - c->respondidas < profundidade
+                   && c->tamanhoSaida + 128 < sizeof(c->saida)) {
+                c->tamanhoSaida += montarRequisicao(c, i, c->enviadas, c->saida + c->tamanhoSaida,
+                                                    sizeof(c->saida) - c->tamanhoSaida);
+                c->envio[c->enviadas % profundidade] = agora();
+                c->enviadas++;
+            }
+
+            pfds[i].fd = c->fd;
+            pfds[i].events = POLLIN | (c->tamanhoSaida > 0 ? POLLOUT : 0);
+        }
+
+        if (poll(pfds, total, -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("Erro no poll");
+            return 1;
+        }
+
+        for (int i = 0; i < total; i++) {
+            Conexao* c = &conexoes[i];
+            if (c->fd < 0 || pfds[i].revents == 0) continue;
+
+            if (pfds[i].revents & POLLOUT) {
+                ssize_t n = send(c->fd, c->saida, c->tamanhoSaida, MSG_NOSIGNAL);
+                if (n > 0) {
+                    memmove(c->saida, c->saida + n, c->tamanhoSaida - (size_t)n);
+                    c->tamanhoSaida -= (size_t)n;
+                }
+            }
+
+            if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+                ssize_t n = recv(c->fd, c->entrada + c->usados, sizeof(c->entrada) - c->usados, 0);
+                if (n <= 0) {
+                    if (n < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+                    fprintf(stderr, "Conexão %d fechada pelo servidor.\n", i);
+                    close(c->fd);
+                    c->fd = -1;
+                    ativas--;
+                    continue;
+                }
+                c->usados += (size_t)n;
+
+                // Cada resposta é "OK"/"ERRO", as linhas de saída e uma linha "."
+                size_t pos = 0;
+                char* fim;
+                while ((fim = memchr(c->entrada + pos, '\n', c->usados - pos)) != NULL) {
+                    char* linha = c->entrada + pos;
+                    size_t tamanho = (size_t)(fim - linha);
+                    if (c->inicioResposta) {
+                        if (tamanho == 4 && memcmp(linha, "ERRO", 4) == 0) {
+                            if (c->respondidas == 0) cadastrosRecusados++; // Voo de uma execução anterior
+                            else erros++;
+                        }
+                        c->inicioResposta = 0;
+                    } else if (tamanho == 1 && linha[0] == '.') {
+                        latencias[medidas++] = agora() - c->envio[c->respondidas % profundidade];
+                        c->respondidas++;
+                        respostas++;
+                        c->inicioResposta = 1;
+                    }
+                    pos = (size_t)(fim - c->entrada) + 1;
+                }
+                memmove(c->entrada, c->entrada + pos, c->usados - pos);
+                c->usados -= pos;
+
+                if (c->respondidas == porConexao) {
+                    close(c->fd);
+                    c->fd = -1;
+                    ativas--;
+                }
+            }
+        }
+    }
+
+    double segundos = agora() - inicio;
+    qsort(latencias, medidas, sizeof(double), compararDouble);
+
+    printf("%d conexões, profundidade %d\n", total, profundidade);
+    printf("%ld respostas em %.3f s: %.0f req/s\n", respostas, segundos, respostas / segundos);
+    printf("%ld erros (%ld voos já existiam)\n", erros, cadastrosRecusados);
+    if (medidas > 0) {
+        printf("latência (us): p50 %.1f  p99 %.1f  máx %.1f\n",
+               latencias[medidas / 2] * 1e6, latencias[medidas * 99 / 100] * 1e6,
+               latencias[medidas - 1] * 1e6);
+    }
+
+    for (int i = 0; i < total; i++) free(conexoes[i].envio);
+    free(conexoes);
+    free(pfds);
+    free(latencias);
+    return erros > 0 ? 2 : 0;
+}
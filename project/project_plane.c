@@ -1,38 +1,104 @@
+// Compilar com: gcc project_plane.c -o project_plane -pthread
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <stddef.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 
 // =================== ESTRUTURAS ===================
 
 /**
- * @brief Estrutura para armazenar a lista de passageiros de um voo (árvore binária).
+ * @brief Chave de comparação de um nome de passageiro, montada uma vez só.
+ * O nome é convertido para minúsculas (mesma regra do strcasecmp) e completado
+ * com zeros; os 8 primeiros bytes também ficam num inteiro big-endian, de modo
+ * que a ordem dos inteiros é a ordem alfabética desses 8 bytes.
+ */
+typedef struct {
+    uint64_t prefixo;
+    char chave[40];
+} ChavePassageiro;
+
+/**
+ * @brief Estrutura para armazenar a lista de passageiros de um voo (árvore AVL por nome).
  */
 typedef struct tree {
     char name[40];
+    ChavePassageiro chave; // Nome normalizado, usado em todas as comparações
     struct tree *left, *right;
+    int altura; // Altura da subárvore (folha = 1)
 } PassengersList;
 
 /**
  * @brief Estrutura para armazenar as informações de um voo.
  */
 typedef struct node {
-    struct node *prox;
+    struct node *prox;          // Próximo voo a decolar (fio em ordem da agenda)
+    struct node *ant;           // Voo que decola logo antes (fio em ordem, no sentido inverso)
+    struct node *esq, *dir;     // Agenda: árvore AVL por (Horario, Prioridade, Sequencia)
+    int alturaAgenda;
     char Id[8];
     char Destino[4];
     char Empresa[20];
     char Registro[9];
     char Modelo[20];
     uint32_t Assentos;
+    uint32_t Horario;           // Data e hora previstas de decolagem, em minutos desde a época Unix
+    uint8_t Prioridade;         // 1 = mais urgente ... 9 = menos urgente
+    uint64_t Sequencia;         // Ordem de chegada na fila (gravada no JSON), com folga entre voos
+    uint32_t totalPassageiros; // Nós em lp, mantido por cadastrar/removerPassageiro
     PassengersList* lp;
+    FILE* journal;              // <Registro>.journal, aberto na primeira alteração
+    uint32_t registrosJournal;  // Registros gravados desde o último snapshot
+    pthread_mutex_t trava;      // Protege lp, totalPassageiros e o journal (iniciada ao enfileirar)
 } Voo;
 
+/**
+ * @brief Índice hash de voos por uma chave de texto (Id ou Registro).
+ * Endereçamento aberto com sondagem linear; a chave é lida direto do Voo no
+ * deslocamento offsetChave, então o índice guarda só ponteiros.
+ */
+typedef struct {
+    Voo** slots;        // NULL = posição vazia
+    size_t capacidade;  // Sempre potência de 2
+    size_t quantidade;
+    size_t offsetChave; // offsetof(Voo, Id) ou offsetof(Voo, Registro)
+} IndiceVoos;
+
 /**
  * @brief Estrutura para gerenciar a fila de voos.
+ * A ordem de decolagem é uma árvore AVL intrusiva nos próprios Voo, ordenada por
+ * horário, prioridade e ordem de chegada; front/prox/ant/rear formam o fio em
+ * ordem dela, duplamente ligado, então o próximo voo sai em O(1), um voo qualquer
+ * sai do fio em O(1) e a listagem é um percurso de lista.
+ * Travas: a fila (ordem, índices e sequência) fica atrás de trava, em modo
+ * leitura para quem só procura voos e em modo escrita para quem enfileira ou
+ * tira voos. Os passageiros de cada voo ficam atrás de Voo.trava, que só é
+ * pega com a trava da fila já em leitura; assim um voo não decola enquanto
+ * alguém mexe nos passageiros dele, e voos diferentes não disputam a mesma trava.
  */
 typedef struct queue {
-    Voo *front;
-    Voo *rear;
+    Voo *front;             // Próximo a decolar (menor da agenda), O(1)
+    Voo *rear;              // Último da agenda
+    Voo *raiz;              // Raiz da agenda
+    IndiceVoos porId;       // Id -> Voo*
+    IndiceVoos porRegistro; // Registro -> Voo*
+    size_t quantidade;      // Voos na fila, mantido por colocar/retirarDaFila
+    uint64_t proximaSequencia; // Sequência do próximo voo cadastrado
+    pthread_rwlock_t trava;
 } QueuePlane;
 
 /**
@@ -48,52 +114,169 @@ typedef enum estados {
     CADASTRAR_PASSAGEIRO = 6,
     REMOVER_PASSAGEIRO = 7,
     LISTAR_PASSAGEIROS = 8,
-    SAIR = 9
+    SAIR = 9,
+    REPROGRAMAR_VOO = 10,
+    CANCELAR_VOO = 11,
+    MOVER_ANTES = 12,
+    MOVER_DEPOIS = 13
 } AIRPORT_STATES_en;
 
+#define PRIORIDADE_PADRAO 5
+
+// Folga entre as sequências de voos cadastrados em seguida: deixa espaço para
+// encaixar um voo movido entre dois vizinhos sem renumerar os outros
+#define ESPACO_SEQUENCIA ((uint64_t)1 << 16)
+
+// Gravação dos arquivos JSON e journal; o benchmark de check-in pode desligar
+static int persistenciaAtiva = 1;
+
 // =================== FUNCTIONS DECLARATIONS ===================
 
 // --- voo functions ---
 void cadastrarVoo(QueuePlane* queue);
-void autorizarDecolagem(QueuePlane* queue);
-void listarPrimeiroVoo(QueuePlane* queue);
-void listarTodosVoos(QueuePlane* queue);
-void contarVoos(QueuePlane* queue);
+int registrarVoo(QueuePlane* queue, const char* registro, const char* id, const char* destino,
+                 const char* empresa, const char* modelo, uint32_t assentos,
+                 uint32_t horario, int prioridade, FILE* out);
+int autorizarDecolagem(QueuePlane* queue, FILE* out);
+int cancelarVoo(QueuePlane* queue, const char* id, FILE* out);
+int reprogramarVoo(QueuePlane* queue, const char* id, uint32_t horario, int prioridade, FILE* out);
+void gerenciarReprogramacao(QueuePlane* queue);
+void gerenciarCancelamento(QueuePlane* queue);
+int moverVoo(QueuePlane* queue, const char* id, const char* idReferencia, int depois, FILE* out);
+void gerenciarMovimentacao(QueuePlane* queue, int depois);
+void listarPrimeiroVoo(QueuePlane* queue, FILE* out);
+void listarTodosVoos(QueuePlane* queue, FILE* out);
+void contarVoos(QueuePlane* queue, FILE* out);
+void inicializarFila(QueuePlane* queue);
 void liberarFila(QueuePlane** queue);
+void enfileirarVoo(QueuePlane* queue, Voo* voo);
+void colocarNaFila(QueuePlane* queue, Voo* voo);
+void retirarDaFila(QueuePlane* queue, Voo* voo);
+int lerHorario(const char* texto, uint32_t* minutos);
+void formatarHorario(uint32_t minutos, char* destino, size_t tamanho);
+uint32_t minutosAgora(void);
 
 // --- passenger functions ---
 PassengersList* cadastrarPassageiro(PassengersList* root, char* name, uint32_t* total, uint32_t max);
 PassengersList* removerPassageiro(PassengersList* root, char* name, uint32_t* total);
-void listarPassageiros(PassengersList* root);
+PassengersList* buscarPassageiro(PassengersList* root, const char* name);
+void montarChavePassageiro(ChavePassageiro* chave, const char* name);
+void listarPassageiros(PassengersList* root, FILE* out);
 void liberarPassageiros(PassengersList* root);
+int alturaPassageiro(PassengersList* node);
+PassengersList* rotacaoDireita(PassengersList* y);
+PassengersList* rotacaoEsquerda(PassengersList* x);
+PassengersList* balancear(PassengersList* node);
 void gerenciarCadastroPassageiro(QueuePlane* queue);
 void gerenciarRemocaoPassageiro(QueuePlane* queue);
 void gerenciarListagemPassageiros(QueuePlane* queue);
+int embarcarPassageiro(QueuePlane* queue, const char* idVoo, const char* nomePassageiro, FILE* out);
+int desembarcarPassageiro(QueuePlane* queue, const char* idVoo, const char* nomePassageiro, FILE* out);
+int mostrarPassageiros(QueuePlane* queue, const char* idVoo, FILE* out);
 
 // --- auxiliary functions ---
 void manage_fsm_airport(QueuePlane* queue, AIRPORT_STATES_en state);
 AIRPORT_STATES_en get_airport_state(void);
 Voo* encontrarVoo(QueuePlane* queue, const char* id);
+Voo* encontrarVooPorRegistro(QueuePlane* queue, const char* registro);
+int registroValido(const char* registro);
+Voo* travarVoo(QueuePlane* queue, const char* id);
+void destravarVoo(QueuePlane* queue, Voo* voo);
 PassengersList* encontrarMinimo(PassengersList* node);
 void limparBuffer(void);
 
-void salvarVooEmJson(Voo* voo);
+// --- script mode ---
+int executarComando(QueuePlane* queue, char* linha, FILE* out);
+int executarScript(QueuePlane* queue, FILE* in, FILE* out);
+
+// --- server mode ---
+int executarServidor(QueuePlane* queue, const char* caminho);
+int executarBenchCheckin(int threads, long operacoes, int comDisco);
+
+// --- index functions ---
+void inicializarIndice(IndiceVoos* indice, size_t offsetChave);
+void indiceInserir(IndiceVoos* indice, Voo* voo);
+void indiceRemover(IndiceVoos* indice, Voo* voo);
+Voo* indiceBuscar(const IndiceVoos* indice, const char* chave);
+void liberarIndice(IndiceVoos* indice);
+
+int salvarVooEmJson(Voo* voo);
 void escreverPassageirosJson(FILE* file, PassengersList* root, int* isFirst);
+void registrarNoJournal(Voo* voo, char operacao, const char* name);
+void registrarAgendamento(Voo* voo);
+void compactarVoo(Voo* voo);
+void fecharJournal(Voo* voo);
+void carregarVoos(QueuePlane* queue);
+Voo* carregarVooDoJson(const char* filename);
+uint32_t aplicarJournal(Voo* voo);
+PassengersList* construirArvoreOrdenada(char (*nomes)[40], const ChavePassageiro* chaves, size_t n);
 
 // =================== FUNÇÃO PRINCIPAL ===================
 
 /**
  * @brief Função principal que inicia o sistema de gerenciamento de voos.
  * Cria a fila de voos e gerencia o loop de estados da máquina de estados do aeroporto.
+ * Com "--script [arquivo]" lê os comandos do arquivo (ou da entrada padrão) sem menu;
+ * com "--servidor <socket>" atende os mesmos comandos por um socket Unix;
+ * "--bench-checkin" mede a escalabilidade das travas por voo.
  */
-int main() {
+int main(int argc, char* argv[]) {
+    FILE* script = NULL;
+    const char* servidor = NULL;
+    if (argc > 1 && strcmp(argv[1], "--bench-checkin") == 0) {
+        // Usa uma fila própria e não carrega os voos do disco
+        int threads = argc > 2 ? atoi(argv[2]) : 4;
+        long operacoes = argc > 3 ? atol(argv[3]) : 200000;
+        int comDisco = argc > 4 && strcmp(argv[4], "--disco") == 0;
+        if (threads < 1 || threads > 256 || operacoes < 2) {
+            fprintf(stderr, "Uso: %s --bench-checkin [threads] [operacoes por thread] [--disco]\n", argv[0]);
+            return 1;
+        }
+        return executarBenchCheckin(threads, operacoes, comDisco);
+    }
+    if (argc > 2 && strcmp(argv[1], "--servidor") == 0) {
+        servidor = argv[2];
+    } else if (argc > 1) {
+        if (strcmp(argv[1], "--script") != 0) {
+            fprintf(stderr, "Uso: %s [--script [arquivo|-] | --servidor <socket> | --bench-checkin ...]\n", argv[0]);
+            return 1;
+        }
+        // Sem terminal do outro lado: a saída vai em blocos grandes, não linha a linha
+        static char bufferSaida[1 << 16];
+        setvbuf(stdout, bufferSaida, _IOFBF, sizeof(bufferSaida));
+
+        script = stdin;
+        if (argc > 2 && strcmp(argv[2], "-") != 0) {
+            script = fopen(argv[2], "r");
+            if (script == NULL) {
+                perror("Erro ao abrir o script");
+                return 1;
+            }
+        }
+    }
+
     QueuePlane* fila_de_avioes = (QueuePlane*)malloc(sizeof(QueuePlane));
     if (fila_de_avioes == NULL) {
         printf("Erro crítico de alocação de memória.\n");
         return 1;
     }
-    fila_de_avioes->front = NULL;
-    fila_de_avioes->rear = NULL;
+    inicializarFila(fila_de_avioes);
+
+    // Recupera os voos que ficaram em disco (snapshot + journal de cada um)
+    carregarVoos(fila_de_avioes);
+
+    if (servidor != NULL) {
+        int resultado = executarServidor(fila_de_avioes, servidor);
+        liberarFila(&fila_de_avioes);
+        return resultado;
+    }
+
+    if (script != NULL) {
+        int erros = executarScript(fila_de_avioes, script, stdout);
+        if (script != stdin) fclose(script);
+        liberarFila(&fila_de_avioes);
+        return erros > 0 ? 2 : 0;
+    }
 
     AIRPORT_STATES_en estado_atual;
     do {
@@ -119,16 +302,16 @@ void manage_fsm_airport(QueuePlane* queue, AIRPORT_STATES_en state) {
             cadastrarVoo(queue); 
             break;
         case AUTORIZAR_DECOLAGEM: 
-            autorizarDecolagem(queue); 
+            autorizarDecolagem(queue, stdout); 
             break;
         case LISTAR_1_VOO: 
-            listarPrimeiroVoo(queue); 
+            listarPrimeiroVoo(queue, stdout); 
             break;
         case LISTAR_ALL_VOOS: 
-            listarTodosVoos(queue);
+            listarTodosVoos(queue, stdout);
              break;
         case CONTAR_VOOS: 
-            contarVoos(queue);
+            contarVoos(queue, stdout);
              break;
         case CADASTRAR_PASSAGEIRO: 
             gerenciarCadastroPassageiro(queue); 
@@ -139,6 +322,16 @@ void manage_fsm_airport(QueuePlane* queue, AIRPORT_STATES_en state) {
         case LISTAR_PASSAGEIROS: 
             gerenciarListagemPassageiros(queue); 
             break;
+        case REPROGRAMAR_VOO:
+            gerenciarReprogramacao(queue);
+            break;
+        case CANCELAR_VOO:
+            gerenciarCancelamento(queue);
+            break;
+        case MOVER_ANTES:
+        case MOVER_DEPOIS:
+            gerenciarMovimentacao(queue, state == MOVER_DEPOIS);
+            break;
         case SAIR: 
             printf("Iniciando processo de encerramento...\n"); 
             break;
@@ -169,6 +362,11 @@ AIRPORT_STATES_en get_airport_state(void) {
     printf("7: Remover passageiro de um voo\n");
     printf("8: Listar passageiros de um voo\n");
     printf("-------------------------------------------------\n");
+    printf("10: Reprogramar horário/prioridade de um voo\n");
+    printf("11: Cancelar um voo\n");
+    printf("12: Mover um voo para antes de outro\n");
+    printf("13: Mover um voo para depois de outro\n");
+    printf("-------------------------------------------------\n");
     printf("9: Sair\n");
     printf("=================================================\n");
     printf("SELECIONE A AÇÃO: ");
@@ -181,357 +379,1833 @@ AIRPORT_STATES_en get_airport_state(void) {
     return (AIRPORT_STATES_en)choice;
 }
 
-// =================== FUNÇÕES DE VOO ===================
+// =================== MODO SCRIPT ===================
 
 /**
- * @brief Coleta os dados de um novo voo, o adiciona à fila e cria seu arquivo JSON.
- * @param queue Ponteiro para a fila de voos a ser modificada.
+ * @brief Palavra usada no script para cada ação do menu.
  */
-void cadastrarVoo(QueuePlane* queue) {
-    Voo* newVoo = (Voo*)malloc(sizeof(Voo));
-    if(newVoo == NULL) {
-        printf("Não foi possível alocar memória para um novo voo.\n");
-        return;
-    }
-
-    printf("\n--- CADASTRO DE NOVO VOO ---\n");
-    printf("Registro da Aeronave (ex: PR-GUO, será o nome do arquivo): ");
-    scanf("%8s", newVoo->Registro);
-    printf("ID (ex: G3-1234): ");
-    scanf("%7s", newVoo->Id);
-    printf("Destino (3 letras, ex: CWB): ");
-    scanf("%3s", newVoo->Destino);
-    printf("Empresa: ");
-    scanf("%19s", newVoo->Empresa);
-    printf("Modelo da Aeronave: ");
-    scanf("%19s", newVoo->Modelo);
-
-    printf("Quantidade de assentos: ");
-    while (scanf("%u", &newVoo->Assentos) != 1 || newVoo->Assentos < 1) {
-        printf("Entrada inválida. Digite um número de assentos maior que 0: ");
-        limparBuffer();
-    }
-    limparBuffer();
+typedef struct {
+    const char* nome;
+    AIRPORT_STATES_en estado;
+} ComandoScript;
+
+static const ComandoScript comandosScript[] = {
+    { "voo",         CADASTRAR_VOO },        // voo <registro> <id> <destino> <empresa> <modelo> <assentos> [horário] [prioridade]
+    { "decolar",     AUTORIZAR_DECOLAGEM },
+    { "proximo",     LISTAR_1_VOO },
+    { "listar",      LISTAR_ALL_VOOS },
+    { "contar",      CONTAR_VOOS },
+    { "embarcar",    CADASTRAR_PASSAGEIRO }, // embarcar <id> <nome completo>
+    { "remover",     REMOVER_PASSAGEIRO },   // remover <id> <nome completo>
+    { "passageiros", LISTAR_PASSAGEIROS },   // passageiros <id>
+    { "sair",        SAIR },
+    { "reprogramar", REPROGRAMAR_VOO },      // reprogramar <id> <horário> [prioridade]
+    { "cancelar",    CANCELAR_VOO },         // cancelar <id>
+    { "antes",       MOVER_ANTES },          // antes <id> <id de referência>
+    { "depois",      MOVER_DEPOIS },         // depois <id> <id de referência>
+};
+
+// Lê a próxima palavra de *p; falha se não houver ou se não couber em destino
+static int lerPalavra(const char** p, char* destino, size_t tamanho) {
+    const char* s = *p;
+    while (isspace((unsigned char)*s)) s++;
+    size_t n = 0;
+    while (s[n] != '\0' && !isspace((unsigned char)s[n])) n++;
+    if (n == 0 || n >= tamanho) return 0;
+    memcpy(destino, s, n);
+    destino[n] = '\0';
+    *p = s + n;
+    return 1;
+}
 
-    newVoo->lp = NULL;
-    newVoo->prox = NULL;
+// O resto da linha, sem espaços nas pontas, é o nome do passageiro
+static int lerNome(const char* p, char* destino, size_t tamanho) {
+    while (isspace((unsigned char)*p)) p++;
+    size_t n = strlen(p);
+    while (n > 0 && isspace((unsigned char)p[n - 1])) n--;
+    if (n == 0 || n >= tamanho) return 0;
+    memcpy(destino, p, n);
+    destino[n] = '\0';
+    return 1;
+}
 
-    if(queue->front == NULL) {
-        queue->front = newVoo;
-        queue->rear = newVoo;
-    } else {
-        queue->rear->prox = newVoo;
-        queue->rear = newVoo;
-    }
-    printf("\nVoo %s cadastrado com sucesso!\n", newVoo->Id);
+// Confere que não sobrou nada na linha depois dos argumentos
+static int fimDaLinha(const char* p) {
+    while (isspace((unsigned char)*p)) p++;
+    return *p == '\0';
+}
 
-    salvarVooEmJson(newVoo);
+// Lê "[horário] [prioridade]" até o fim da linha (horário como em lerHorario);
+// o que faltar fica com o valor já em *horario/*prioridade
+static int lerAgendamento(const char* p, uint32_t* horario, int* prioridade) {
+    char texto[20];
+    if (!lerPalavra(&p, texto, sizeof(texto))) return fimDaLinha(p);
+    if (!lerHorario(texto, horario)) return 0;
+    if (!lerPalavra(&p, texto, sizeof(texto))) return fimDaLinha(p);
+    if (texto[0] < '1' || texto[0] > '9' || texto[1] != '\0') return 0;
+    *prioridade = texto[0] - '0';
+    return fimDaLinha(p);
 }
 
 /**
- * @brief Simula decolagem, removendo o voo da fila, sua memória e seu arquivo JSON.
+ * @brief Executa uma linha de comando do modo script chamando direto as funções do menu.
+ * Aceita a palavra do comando ou o número da opção do menu; linhas vazias e
+ * comentários (#) são ignorados.
  * @param queue Ponteiro para a fila de voos.
+ * @param linha Linha do comando, sem a quebra de linha.
+ * @param out Onde escrever as respostas e os erros.
+ * @return 1 se o comando deu certo (ou foi ignorado), 0 se falhou, -1 para "sair".
  */
-void autorizarDecolagem(QueuePlane* queue) {
-    if (queue->front == NULL) {
-        printf("Nenhum voo na fila para decolagem.\n");
-        return;
-    }
+int executarComando(QueuePlane* queue, char* linha, FILE* out) {
+    const char* p = linha;
+    char palavra[16];
 
-    Voo* decolando = queue->front;
-    printf("\nAutorizando decolagem do Voo %s, destino %s.\n", decolando->Id, decolando->Destino);
+    while (isspace((unsigned char)*p)) p++;
+    if (*p == '\0' || *p == '#') return 1;
 
-    char filename[20];
-    sprintf(filename, "%s.json", decolando->Registro);
-    if (remove(filename) == 0) {
-        printf("Arquivo '%s' de registro do voo foi removido.\n", filename);
-    } else {
-        perror("Erro ao remover o arquivo do voo");
+    if (!lerPalavra(&p, palavra, sizeof(palavra))) {
+        fprintf(out, "Comando inválido.\n");
+        return 0;
     }
 
-    queue->front = queue->front->prox;
-    if (queue->front == NULL) {
-        queue->rear = NULL;
+    int estado = -1;
+    for (size_t i = 0; i < sizeof(comandosScript) / sizeof(comandosScript[0]); i++) {
+        if (strcmp(palavra, comandosScript[i].nome) == 0) {
+            estado = comandosScript[i].estado;
+            break;
+        }
+    }
+    if (estado < 0 && isdigit((unsigned char)palavra[0])
+        && (palavra[1] == '\0' || (isdigit((unsigned char)palavra[1]) && palavra[2] == '\0'))) {
+        estado = atoi(palavra);
     }
 
-    liberarPassageiros(decolando->lp);
-    free(decolando);
-
-    printf("Voo decolou. Fila e arquivos atualizados.\n");
+    char registro[9], id[8], destino[4], empresa[20], modelo[20], numero[12];
+    char nome[40];
+
+    switch (estado) {
+        case CADASTRAR_VOO: {
+            char* fim;
+            uint32_t horario = minutosAgora(); // Sem horário: decola assim que possível
+            int prioridade = PRIORIDADE_PADRAO;
+            if (!lerPalavra(&p, registro, sizeof(registro)) || !lerPalavra(&p, id, sizeof(id))
+                || !lerPalavra(&p, destino, sizeof(destino)) || !lerPalavra(&p, empresa, sizeof(empresa))
+                || !lerPalavra(&p, modelo, sizeof(modelo)) || !lerPalavra(&p, numero, sizeof(numero))
+                || !lerAgendamento(p, &horario, &prioridade)) {
+                fprintf(out, "Uso: voo <registro> <id> <destino> <empresa> <modelo> <assentos> [HH:MM|AAAA-MM-DDTHH:MM] [prioridade 1-9]\n");
+                return 0;
+            }
+            unsigned long assentos = strtoul(numero, &fim, 10);
+            if (*fim != '\0' || numero[0] == '-' || assentos < 1 || assentos > UINT32_MAX) {
+                fprintf(out, "Quantidade de assentos inválida: %s\n", numero);
+                return 0;
+            }
+            return registrarVoo(queue, registro, id, destino, empresa, modelo, (uint32_t)assentos,
+                                horario, prioridade, out);
+        }
+        case REPROGRAMAR_VOO: {
+            uint32_t horario = UINT32_MAX;
+            int prioridade = -1; // Sem prioridade: mantém a atual
+            if (!lerPalavra(&p, id, sizeof(id)) || !lerAgendamento(p, &horario, &prioridade)
+                || horario == UINT32_MAX) {
+                fprintf(out, "Uso: reprogramar <id> <HH:MM|AAAA-MM-DDTHH:MM> [prioridade 1-9]\n");
+                return 0;
+            }
+            return reprogramarVoo(queue, id, horario, prioridade, out);
+        }
+        case CANCELAR_VOO:
+            if (!lerPalavra(&p, id, sizeof(id)) || !fimDaLinha(p)) {
+                fprintf(out, "Uso: cancelar <id>\n");
+                return 0;
+            }
+            return cancelarVoo(queue, id, out);
+        case MOVER_ANTES:
+        case MOVER_DEPOIS: {
+            char referencia[8];
+            if (!lerPalavra(&p, id, sizeof(id)) || !lerPalavra(&p, referencia, sizeof(referencia))
+                || !fimDaLinha(p)) {
+                fprintf(out, "Uso: %s <id> <id de referência>\n", estado == MOVER_DEPOIS ? "depois" : "antes");
+                return 0;
+            }
+            return moverVoo(queue, id, referencia, estado == MOVER_DEPOIS, out);
+        }
+        case AUTORIZAR_DECOLAGEM:
+            return autorizarDecolagem(queue, out);
+        case LISTAR_1_VOO:
+            listarPrimeiroVoo(queue, out);
+            return 1;
+        case LISTAR_ALL_VOOS:
+            listarTodosVoos(queue, out);
+            return 1;
+        case CONTAR_VOOS:
+            contarVoos(queue, out);
+            return 1;
+        case CADASTRAR_PASSAGEIRO:
+        case REMOVER_PASSAGEIRO:
+            if (!lerPalavra(&p, id, sizeof(id)) || !lerNome(p, nome, sizeof(nome))) {
+                fprintf(out, "Uso: %s <id> <nome completo (até 39 caracteres)>\n",
+                        estado == CADASTRAR_PASSAGEIRO ? "embarcar" : "remover");
+                return 0;
+            }
+            if (estado == CADASTRAR_PASSAGEIRO)
+                return embarcarPassageiro(queue, id, nome, out);
+            return desembarcarPassageiro(queue, id, nome, out);
+        case LISTAR_PASSAGEIROS:
+            if (!lerPalavra(&p, id, sizeof(id)) || !fimDaLinha(p)) {
+                fprintf(out, "Uso: passageiros <id>\n");
+                return 0;
+            }
+            return mostrarPassageiros(queue, id, out);
+        case SAIR:
+            return -1;
+        default:
+            fprintf(out, "Comando desconhecido: %s\n", palavra);
+            return 0;
+    }
 }
 
 /**
- * @brief Exibe o próximo voo na fila e suas informações.
+ * @brief Executa um script de comandos, uma linha por vez, sem menu nem pausas.
+ * As linhas que falharam são apontadas em stderr com o número da linha.
  * @param queue Ponteiro para a fila de voos.
+ * @param in Arquivo (ou stdin) com os comandos.
+ * @param out Onde escrever as respostas.
+ * @return Quantidade de comandos que falharam.
  */
-void listarPrimeiroVoo(QueuePlane* queue) {
-    if (queue->front == NULL) {
-        printf("Nenhum voo na fila.\n");
-        return;
+int executarScript(QueuePlane* queue, FILE* in, FILE* out) {
+    char linha[256];
+    unsigned long numeroLinha = 0;
+    unsigned long comandos = 0;
+    int erros = 0;
+
+    while (fgets(linha, sizeof(linha), in) != NULL) {
+        numeroLinha++;
+        size_t n = strcspn(linha, "\n");
+        if (linha[n] != '\n' && !feof(in)) {
+            // Linha maior que o buffer: descarta o resto e conta como erro
+            int c;
+            while ((c = getc(in)) != '\n' && c != EOF);
+            fprintf(out, "Linha muito longa.\n");
+            fprintf(stderr, "Linha %lu: muito longa\n", numeroLinha);
+            erros++;
+            continue;
+        }
+        linha[n] = '\0';
+        if (n > 0 && linha[n - 1] == '\r') linha[n - 1] = '\0';
+
+        int resultado = executarComando(queue, linha, out);
+        if (resultado < 0) break;
+        comandos++;
+        if (resultado == 0) {
+            fprintf(stderr, "Linha %lu: falhou (%s)\n", numeroLinha, linha);
+            erros++;
+        }
     }
-    Voo* p = queue->front;
-    printf("\n--- PRÓXIMO VOO A DECOLAR ---\n");
-    printf("ID: %s\nRegistro: %s\nDestino: %s\nEmpresa: %s\nAeronave: %s\nAssentos: %u\n",
-        p->Id, p->Registro, p->Destino, p->Empresa, p->Modelo, p->Assentos);
+
+    fflush(out);
+    fprintf(stderr, "%lu linhas processadas, %d com erro.\n", comandos, erros);
+    return erros;
 }
 
-/**
- * @brief Lista todos os voos na fila, exibindo suas informações.
- * @param queue Ponteiro para a fila de voos.
+// =================== MODO SERVIDOR ===================
+
+/*
+ * Protocolo (texto, uma requisição por linha, com os mesmos comandos do modo script):
+ *   cliente -> "embarcar G3-1234 Maria da Silva\n"
+ *   servidor -> "OK\n" ou "ERRO\n", as linhas de saída do comando e uma linha "."
+ * O cliente pode mandar várias requisições sem esperar as respostas (pipelining);
+ * elas são executadas e respondidas na ordem em que chegaram.
  */
-void listarTodosVoos(QueuePlane* queue) {
-    if (queue->front == NULL) {
-        printf("Fila de voos está vazia.\n");
-        return;
-    }
-    Voo* atual = queue->front;
-    int pos = 1;
-    printf("\n--- FILA DE VOOS PARA DECOLAGEM ---\n");
-    while (atual != NULL) {
-        printf("%d. Voo %s | Registro: %s | Destino: %s\n", pos++, atual->Id, atual->Registro, atual->Destino);
-        atual = atual->prox;
-    }
-}
+
+#define SERVIDOR_MAX_EVENTOS 64
+#define CONEXAO_ENTRADA 4096           // Maior linha aceita de um cliente
+#define CONEXAO_SAIDA_LIMITE (1 << 20) // Acima disso para de ler até o cliente consumir as respostas
 
 /**
- * @brief Conta o número de voos na fila e exibe a quantidade.
- * @param queue Ponteiro para a fila de voos.
+ * @brief Estado de um cliente conectado ao servidor.
  */
-void contarVoos(QueuePlane* queue) {
-    int count = 0;
-    Voo* atual = queue->front;
-    while(atual != NULL) {
-        count++;
-        atual = atual->prox;
-    }
-    if (count == 0)
-        printf("Não há voos na fila.\n");
-    else if (count == 1)
-        printf("Há 1 voo na fila.\n");
-    else
-        printf("Há %d voos na fila.\n", count);
+typedef struct conexao {
+    int fd;
+    char entrada[CONEXAO_ENTRADA]; // Bytes recebidos que ainda não formam uma linha completa
+    size_t usados;
+    char* saida;                   // Respostas esperando para serem enviadas
+    size_t tamanhoSaida;
+    size_t capacidadeSaida;
+    size_t enviados;               // Quanto de saida já foi para o socket
+    uint32_t eventos;              // Eventos registrados no epoll
+    int encerrar;                  // Fecha assim que a saída for enviada ("sair" ou erro)
+    int fimDaEntrada;              // O cliente já fechou o lado dele
+    struct conexao *ant, *prox;    // Lista das conexões abertas
+} Conexao;
+
+static volatile sig_atomic_t servidorAtivo = 1;
+
+static void pararServidor(int sinal) {
+    (void)sinal;
+    servidorAtivo = 0;
 }
 
-/**
- * @brief Libera toda a memória alocada para a fila de voos e seus elementos.
- * @param queue Ponteiro duplo para a fila de voos, que será setado como NULL após a liberação.
- */
-void liberarFila(QueuePlane** queue) {
-    if (queue == NULL || *queue == NULL) return;
-    Voo* atual = (*queue)->front;
-    while(atual != NULL) {
-        Voo* temp = atual;
-        atual = atual->prox;
-        liberarPassageiros(temp->lp);
-        free(temp);
+static int tornarNaoBloqueante(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags < 0 ? -1 : fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+static void anexarSaida(Conexao* c, const char* dados, size_t n) {
+    if (c->tamanhoSaida + n > c->capacidadeSaida) {
+        size_t capacidade = c->capacidadeSaida ? c->capacidadeSaida : 4096;
+        while (capacidade < c->tamanhoSaida + n) capacidade *= 2;
+        char* nova = (char*)realloc(c->saida, capacidade);
+        if (nova == NULL) {
+            printf("Erro crítico de alocação de memória.\n");
+            exit(1);
+        }
+        c->saida = nova;
+        c->capacidadeSaida = capacidade;
     }
-    free(*queue);
-    *queue = NULL;
+    memcpy(c->saida + c->tamanhoSaida, dados, n);
+    c->tamanhoSaida += n;
 }
 
-// =================== FUNÇÕES DE PASSAGEIROS ===================
+// Executa uma linha e enfileira a resposta (status, saída do comando e ".")
+static void responder(QueuePlane* queue, Conexao* c, char* linha) {
+    char* corpo = NULL;
+    size_t tamanho = 0;
+    FILE* out = open_memstream(&corpo, &tamanho);
+    if (out == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
 
-/**
- * @brief Cadastra um novo passageiro na árvore binária de passageiros do voo.
- * Protege contra buffer overflow e excesso de passageiros.
- * @param root Raiz da árvore de passageiros.
- * @param name Nome do passageiro a ser cadastrado.
- * @param total Ponteiro para o total de passageiros já cadastrados.
- * @param max Número máximo de assentos disponíveis.
- * @return Retorna a nova raiz da árvore (pode ser a mesma ou um novo nó).
- */
-PassengersList* cadastrarPassageiro(PassengersList* root, char* name, uint32_t* total, uint32_t max) {
-    if (*total >= max) {
-        printf("Limite de passageiros atingido para este voo.\n");
-        return root;
+    int resultado = executarComando(queue, linha, out);
+    fclose(out);
+
+    anexarSaida(c, resultado == 0 ? "ERRO\n" : "OK\n", resultado == 0 ? 5 : 3);
+    anexarSaida(c, corpo, tamanho);
+    anexarSaida(c, ".\n", 2);
+    free(corpo);
+
+    if (resultado < 0) c->encerrar = 1; // "sair" fecha só esta conexão
+}
+
+// Atende as linhas completas já recebidas, respeitando o limite de saída pendente
+static void processarEntrada(QueuePlane* queue, Conexao* c) {
+    size_t inicio = 0;
+
+    while (!c->encerrar && c->tamanhoSaida - c->enviados < CONEXAO_SAIDA_LIMITE) {
+        char* fim = memchr(c->entrada + inicio, '\n', c->usados - inicio);
+        if (fim == NULL) break;
+        *fim = '\0';
+        if (fim > c->entrada + inicio && fim[-1] == '\r') fim[-1] = '\0';
+        responder(queue, c, c->entrada + inicio);
+        inicio = (size_t)(fim - c->entrada) + 1;
     }
-    if (root == NULL) {
-        PassengersList* newP = (PassengersList*)malloc(sizeof(PassengersList));
-        if (newP == NULL) {
-            printf("Falha na alocação.\n");
-            return root;
-        }
-        strncpy(newP->name, name, sizeof(newP->name) - 1);
-        newP->name[sizeof(newP->name) - 1] = '\0';
-        newP->left = newP->right = NULL;
-        (*total)++;
-        return newP;
+
+    memmove(c->entrada, c->entrada + inicio, c->usados - inicio);
+    c->usados -= inicio;
+
+    if (c->usados == sizeof(c->entrada) && !c->encerrar) {
+        const char erro[] = "ERRO\nLinha muito longa.\n.\n";
+        anexarSaida(c, erro, sizeof(erro) - 1);
+        c->encerrar = 1;
     }
-    if (strcasecmp(name, root->name) < 0)
-        root->left = cadastrarPassageiro(root->left, name, total, max);
-    else if (strcasecmp(name, root->name) > 0)
-        root->right = cadastrarPassageiro(root->right, name, total, max);
-    return root;
 }
 
-/**
- * @brief Remove um passageiro da árvore binária de passageiros do voo.
- * @param root Raiz da árvore de passageiros.
- * @param name Nome do passageiro a ser removido.
- * @param total Ponteiro para o total de passageiros já cadastrados.
- * @return Retorna a nova raiz da árvore (pode ser a mesma ou um novo nó).
- */
-PassengersList* removerPassageiro(PassengersList* root, char* name, uint32_t* total) {
-    if (root == NULL) return root;
-    if (strcasecmp(name, root->name) < 0)
-        root->left = removerPassageiro(root->left, name, total);
-    else if (strcasecmp(name, root->name) > 0)
-        root->right = removerPassageiro(root->right, name, total);
-    else {
-        if (root->left == NULL) {
-            PassengersList* temp = root->right;
-            free(root);
-            (*total)--;
-            return temp;
-        } else if (root->right == NULL) {
-            PassengersList* temp = root->left;
-            free(root);
-            (*total)--;
-            return temp;
+// Envia o que der sem bloquear; retorna 0 se a conexão caiu
+static int enviarSaida(Conexao* c) {
+    while (c->enviados < c->tamanhoSaida) {
+        ssize_t n = send(c->fd, c->saida + c->enviados, c->tamanhoSaida - c->enviados, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
         }
-        PassengersList* temp = encontrarMinimo(root->right);
-        strncpy(root->name, temp->name, sizeof(root->name) - 1);
-        root->name[sizeof(root->name) - 1] = '\0';
-        root->right = removerPassageiro(root->right, temp->name, total);
+        c->enviados += (size_t)n;
     }
-    return root;
+    c->enviados = 0;
+    c->tamanhoSaida = 0;
+    return 1;
 }
 
-/**
- * @brief Lista todos os passageiros em ordem alfabética.
- * @param root Raiz da árvore de passageiros.
- */
-void listarPassageiros(PassengersList* root) {
-    if (root != NULL) {
-        listarPassageiros(root->left);
-        printf("- %s\n", root->name);
-        listarPassageiros(root->right);
+// Lê só quando há espaço para mais respostas; pede EPOLLOUT enquanto houver saída pendente
+static void atualizarEventos(int epollFd, Conexao* c) {
+    size_t pendente = c->tamanhoSaida - c->enviados;
+    uint32_t eventos = 0;
+    if (!c->encerrar && !c->fimDaEntrada && pendente < CONEXAO_SAIDA_LIMITE) eventos |= EPOLLIN;
+    if (pendente > 0) eventos |= EPOLLOUT;
+
+    if (eventos != c->eventos) {
+        struct epoll_event ev = { .events = eventos, .data.ptr = c };
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, c->fd, &ev);
+        c->eventos = eventos;
     }
 }
 
-/**
- * @brief Libera toda a memória alocada para a árvore de passageiros.
- * @param root Raiz da árvore de passageiros.
- */
-void liberarPassageiros(PassengersList* root) {
-    if (root != NULL) {
-        liberarPassageiros(root->left);
-        liberarPassageiros(root->right);
-        free(root);
-    }
+static void fecharConexao(Conexao** lista, Conexao* c) {
+    close(c->fd); // Também tira o fd do epoll
+    if (c->ant) c->ant->prox = c->prox;
+    else *lista = c->prox;
+    if (c->prox) c->prox->ant = c->ant;
+    free(c->saida);
+    free(c);
 }
 
-/**
- * @brief Gerencia o cadastro de um passageiro em um voo.
- * Protege contra excesso de passageiros e buffer overflow.
- * @param queue Ponteiro para a fila de voos.
- */
-void gerenciarCadastroPassageiro(QueuePlane* queue) {
-    char idVoo[8];
-    printf("Digite o ID do voo para adicionar o passageiro: ");
-    scanf("%7s", idVoo);
-
-    Voo* vooAlvo = encontrarVoo(queue, idVoo);
-    if (vooAlvo == NULL) {
-        printf("Voo com ID %s não encontrado.\n", idVoo);
-        return;
-    }
+static void aceitarConexoes(int epollFd, int servidorFd, Conexao** lista) {
+    while (1) {
+        int fd = accept(servidorFd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) perror("Erro ao aceitar conexão");
+            return;
+        }
 
-    uint32_t total = 0;
-    // Conta passageiros já cadastrados
-    void contar(PassengersList* r) { if (r) { total++; contar(r->left); contar(r->right); } }
-    contar(vooAlvo->lp);
+        Conexao* c = (Conexao*)calloc(1, sizeof(Conexao));
+        if (c == NULL) {
+            printf("Erro crítico de alocação de memória.\n");
+            exit(1);
+        }
+        c->fd = fd;
+        c->eventos = EPOLLIN;
+
+        struct epoll_event ev = { .events = EPOLLIN, .data.ptr = c };
+        if (tornarNaoBloqueante(fd) < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            perror("Erro ao registrar conexão");
+            close(fd);
+            free(c);
+            continue;
+        }
 
-    if (total >= vooAlvo->Assentos) {
-        printf("Todos os assentos deste voo já estão ocupados.\n");
-        return;
+        c->prox = *lista;
+        if (*lista) (*lista)->ant = c;
+        *lista = c;
     }
+}
 
-    char nomePassageiro[40];
-    printf("Digite o nome completo do passageiro: ");
-    limparBuffer();
-    fgets(nomePassageiro, sizeof(nomePassageiro), stdin);
-    nomePassageiro[strcspn(nomePassageiro, "\n")] = 0;
+// Trata os eventos de um cliente; retorna 0 quando a conexão deve ser fechada
+static int atenderConexao(QueuePlane* queue, Conexao* c, uint32_t eventos) {
+    if ((eventos & (EPOLLERR | EPOLLHUP)) && !(eventos & EPOLLIN)) return 0;
+
+    if (eventos & EPOLLIN) {
+        while (!c->fimDaEntrada && c->usados < sizeof(c->entrada)) {
+            ssize_t n = recv(c->fd, c->entrada + c->usados, sizeof(c->entrada) - c->usados, 0);
+            if (n > 0) {
+                c->usados += (size_t)n;
+                continue;
+            }
+            if (n == 0) {
+                // Cliente fechou: a última linha pode ter vindo sem '\n'
+                c->fimDaEntrada = 1;
+                if (c->usados > 0 && c->usados < sizeof(c->entrada) && c->entrada[c->usados - 1] != '\n')
+                    c->entrada[c->usados++] = '\n';
+                break;
+            }
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return 0;
+        }
+    }
 
-    vooAlvo->lp = cadastrarPassageiro(vooAlvo->lp, nomePassageiro, &total, vooAlvo->Assentos);
-    printf("Passageiro '%s' cadastrado no voo %s.\n", nomePassageiro, idVoo);
+    processarEntrada(queue, c);
+    if (!enviarSaida(c)) return 0;
+    if (c->tamanhoSaida > 0) return 1;
 
-    salvarVooEmJson(vooAlvo);
+    // Tudo enviado: fecha se pediram, ou se o cliente saiu e não há mais linhas para atender
+    if (c->encerrar) return 0;
+    return !(c->fimDaEntrada && memchr(c->entrada, '\n', c->usados) == NULL);
 }
 
 /**
- * @brief Gerencia a remoção de um passageiro de um voo.
+ * @brief Atende clientes por um socket Unix até receber SIGINT ou SIGTERM.
+ * Um único laço epoll serve todas as conexões e executa um comando por vez; as
+ * travas da fila e dos voos continuam valendo, porque outras threads podem usar
+ * as mesmas funções. Cada linha recebida é um comando do modo script (veja
+ * executarComando).
  * @param queue Ponteiro para a fila de voos.
+ * @param caminho Caminho do socket (um socket antigo no mesmo caminho é removido;
+ * qualquer outro tipo de arquivo é mantido e o servidor não sobe).
+ * @return 0 quando o servidor termina normalmente, 1 se não foi possível abrir o socket.
  */
-void gerenciarRemocaoPassageiro(QueuePlane* queue) {
-    char idVoo[8];
-    printf("Digite o ID do voo para remover o passageiro: ");
-    scanf("%7s", idVoo);
+int executarServidor(QueuePlane* queue, const char* caminho) {
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        fprintf(stderr, "Caminho do socket muito longo: %s\n", caminho);
+        return 1;
+    }
+    strcpy(endereco.sun_path, caminho);
+
+    // Só apaga o que for socket (de uma execução anterior); nunca um arquivo comum
+    struct stat info;
+    if (lstat(caminho, &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            fprintf(stderr, "'%s' já existe e não é um socket.\n", caminho);
+            return 1;
+        }
+        unlink(caminho);
+    }
 
-    Voo* vooAlvo = encontrarVoo(queue, idVoo);
-    if (vooAlvo == NULL) {
-        printf("Voo com ID %s não encontrado.\n", idVoo);
-        return;
+    int servidorFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (servidorFd < 0) {
+        perror("Erro ao criar o socket");
+        return 1;
+    }
+    if (bind(servidorFd, (struct sockaddr*)&endereco, sizeof(endereco)) < 0
+        || listen(servidorFd, SOMAXCONN) < 0 || tornarNaoBloqueante(servidorFd) < 0) {
+        perror("Erro ao abrir o socket");
+        close(servidorFd);
+        return 1;
     }
 
-    uint32_t total = 0;
-    void contar(PassengersList* r) { if (r) { total++; contar(r->left); contar(r->right); } }
-    contar(vooAlvo->lp);
+    int epollFd = epoll_create1(0);
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = NULL }; // NULL = socket de escuta
+    if (epollFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, servidorFd, &ev) < 0) {
+        perror("Erro ao criar o epoll");
+        close(servidorFd);
+        unlink(caminho);
+        return 1;
+    }
 
-    char nomePassageiro[40];
-    printf("Digite o nome completo do passageiro a ser removido: ");
-    limparBuffer();
-    fgets(nomePassageiro, sizeof(nomePassageiro), stdin);
-    nomePassageiro[strcspn(nomePassageiro, "\n")] = 0;
+    struct sigaction acao;
+    memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = pararServidor; // Sem SA_RESTART: epoll_wait volta com EINTR
+    sigaction(SIGINT, &acao, NULL);
+    sigaction(SIGTERM, &acao, NULL);
+    signal(SIGPIPE, SIG_IGN);
 
-    vooAlvo->lp = removerPassageiro(vooAlvo->lp, nomePassageiro, &total);
-    printf("Tentativa de remoção concluída.\n");
+    printf("Servidor ouvindo em %s\n", caminho);
+    fflush(stdout);
 
-    salvarVooEmJson(vooAlvo);
-}
+    Conexao* conexoes = NULL;
+    struct epoll_event eventos[SERVIDOR_MAX_EVENTOS];
 
-/**
- * @brief Gerencia a listagem de passageiros de um voo.
- * @param queue Ponteiro para a fila de voos.
- */
-void gerenciarListagemPassageiros(QueuePlane* queue) {
-    char idVoo[8];
-    printf("Digite o ID do voo para listar os passageiros: ");
-    scanf("%7s", idVoo);
+    while (servidorAtivo) {
+        int prontos = epoll_wait(epollFd, eventos, SERVIDOR_MAX_EVENTOS, -1);
+        if (prontos < 0) {
+            if (errno == EINTR) continue;
+            perror("Erro no epoll_wait");
+            break;
+        }
 
-    Voo* vooAlvo = encontrarVoo(queue, idVoo);
-    if (vooAlvo == NULL) {
-        printf("Voo com ID %s não encontrado.\n", idVoo);
-        return;
+        for (int i = 0; i < prontos; i++) {
+            Conexao* c = (Conexao*)eventos[i].data.ptr;
+            if (c == NULL) {
+                aceitarConexoes(epollFd, servidorFd, &conexoes);
+            } else if (!atenderConexao(queue, c, eventos[i].events)) {
+                fecharConexao(&conexoes, c);
+            } else {
+                atualizarEventos(epollFd, c);
+            }
+        }
+        fflush(stdout); // Mensagens de gravação dos arquivos
     }
 
-    printf("\n--- LISTA DE PASSAGEIROS DO VOO %s ---\n", idVoo);
-
-    if (vooAlvo->lp == NULL) {
-        printf("Não há passageiros cadastrados neste voo.\n");
-    } else {
-        listarPassageiros(vooAlvo->lp);
-    }
+    while (conexoes != NULL) fecharConexao(&conexoes, conexoes);
+    close(epollFd);
+    close(servidorFd);
+    unlink(caminho);
+    printf("Servidor encerrado.\n");
+    return 0;
 }
 
-// =================== FUNÇÕES AUXILIARES ===================
+// =================== BENCHMARK DE CHECK-IN ===================
 
 /**
- * @brief Busca um voo pelo ID na fila.
- * @param queue Ponteiro para a fila de voos.
- * @param id ID do voo a ser buscado.
- * @return Ponteiro para o voo encontrado ou NULL.
+ * @brief Parâmetros e resultado de uma thread do benchmark de check-in.
  */
-Voo* encontrarVoo(QueuePlane* queue, const char* id) {
-    Voo* atual = queue->front;
-    while (atual != NULL) {
-        if (strcmp(id, atual->Id) == 0)
-            return atual;
-        atual = atual->prox;
+typedef struct {
+    QueuePlane* queue;
+    int thread;
+    int voos;        // Os voos B000000 .. B<voos-1> já estão na fila
+    long operacoes;  // Metade embarques, metade remoções dos mesmos passageiros
+    long falhas;
+} TrabalhoCheckin;
+
+static void* trabalharCheckin(void* arg) {
+    TrabalhoCheckin* t = (TrabalhoCheckin*)arg;
+    FILE* out = fopen("/dev/null", "w"); // Um por thread: um FILE compartilhado seria outra trava
+    char id[12], nome[40];
+    long pares = t->operacoes / 2;
+
+    if (out == NULL) {
+        perror("Erro ao abrir /dev/null");
+        exit(1);
     }
+
+    // Embarca e depois remove os mesmos passageiros; o voo de cada um é sorteado
+    // com a mesma semente nas duas passadas
+    for (int passada = 0; passada < 2; passada++) {
+        uint32_t estado = 2463534242u ^ (uint32_t)(t->thread * 2654435761u);
+        for (long i = 0; i < pares; i++) {
+            estado ^= estado << 13;
+            estado ^= estado >> 17;
+            estado ^= estado << 5;
+            snprintf(id, sizeof(id), "B%06u", estado % (uint32_t)t->voos);
+            snprintf(nome, sizeof(nome), "Thread %d Passageiro %ld", t->thread, i);
+            int ok = passada == 0 ? embarcarPassageiro(t->queue, id, nome, out)
+                                  : desembarcarPassageiro(t->queue, id, nome, out);
+            if (!ok) t->falhas++;
+        }
+    }
+
+    fclose(out);
     return NULL;
 }
 
+static double segundosAgora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Mede quantos check-ins por segundo várias threads conseguem fazer,
+ * variando o número de voos em que os passageiros são distribuídos. Com um voo
+ * só, todas disputam a mesma trava; com mais voos, as threads deveriam escalar.
+ * @param threads Número de threads.
+ * @param operacoes Operações por thread (embarques + remoções).
+ * @param comDisco Se 0, não grava JSON nem journal (mede só as travas e as árvores).
+ * @return 0 se todas as operações deram certo, 2 caso contrário.
+ */
+int executarBenchCheckin(int threads, long operacoes, int comDisco) {
+    pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+    TrabalhoCheckin* trabalhos = (TrabalhoCheckin*)malloc(sizeof(TrabalhoCheckin) * threads);
+    FILE* nulo = fopen("/dev/null", "w");
+    double base = 0;
+    long falhas = 0;
+
+    if (ids == NULL || trabalhos == NULL || nulo == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+    persistenciaAtiva = comDisco;
+
+    printf("Check-in com %d thread(s), %ld operações cada, %s disco\n",
+           threads, operacoes, comDisco ? "com" : "sem");
+    printf("%8s %14s %10s\n", "voos", "operações/s", "ganho");
+
+    for (int voos = 1; voos <= 256; voos *= 4) {
+        QueuePlane* queue = (QueuePlane*)malloc(sizeof(QueuePlane));
+        if (queue == NULL) {
+            printf("Erro crítico de alocação de memória.\n");
+            exit(1);
+        }
+        inicializarFila(queue);
+
+        for (int v = 0; v < voos; v++) {
+            char registro[9], id[8];
+            snprintf(registro, sizeof(registro), "BN-%05d", v);
+            snprintf(id, sizeof(id), "B%06d", v);
+            registrarVoo(queue, registro, id, "BNC", "BENCH", "BENCH", UINT32_MAX, 0, PRIORIDADE_PADRAO, nulo);
+        }
+
+        double inicio = segundosAgora();
+        for (int t = 0; t < threads; t++) {
+            trabalhos[t] = (TrabalhoCheckin){ queue, t, voos, operacoes, 0 };
+            pthread_create(&ids[t], NULL, trabalharCheckin, &trabalhos[t]);
+        }
+        for (int t = 0; t < threads; t++) {
+            pthread_join(ids[t], NULL);
+            falhas += trabalhos[t].falhas;
+        }
+        double taxa = (double)threads * (operacoes / 2 * 2) / (segundosAgora() - inicio);
+
+        if (voos == 1) base = taxa;
+        printf("%8d %14.0f %9.2fx\n", voos, taxa, taxa / base);
+
+        // Decolar apaga os arquivos que o modo com disco criou
+        while (autorizarDecolagem(queue, nulo));
+        liberarFila(&queue);
+    }
+
+    if (falhas > 0) printf("%ld operações falharam.\n", falhas);
+    persistenciaAtiva = 1;
+    fclose(nulo);
+    free(ids);
+    free(trabalhos);
+    return falhas > 0 ? 2 : 0;
+}
+
+// =================== FUNÇÕES DE VOO ===================
+
+/**
+ * @brief Coleta os dados de um novo voo pelo terminal e o cadastra com registrarVoo.
+ * @param queue Ponteiro para a fila de voos a ser modificada.
+ */
+void cadastrarVoo(QueuePlane* queue) {
+    char registro[9], id[8], destino[4], empresa[20], modelo[20], textoHorario[20];
+    uint32_t assentos, horario;
+    int prioridade;
+
+    printf("\n--- CADASTRO DE NOVO VOO ---\n");
+    printf("Registro da Aeronave (ex: PR-GUO, será o nome do arquivo): ");
+    scanf("%8s", registro);
+    printf("ID (ex: G3-1234): ");
+    scanf("%7s", id);
+    printf("Destino (3 letras, ex: CWB): ");
+    scanf("%3s", destino);
+    printf("Empresa: ");
+    scanf("%19s", empresa);
+    printf("Modelo da Aeronave: ");
+    scanf("%19s", modelo);
+
+    printf("Quantidade de assentos: ");
+    while (scanf("%u", &assentos) != 1 || assentos < 1) {
+        printf("Entrada inválida. Digite um número de assentos maior que 0: ");
+        limparBuffer();
+    }
+
+    printf("Horário previsto de decolagem (HH:MM ou AAAA-MM-DDTHH:MM): ");
+    while (scanf("%19s", textoHorario) != 1 || !lerHorario(textoHorario, &horario)) {
+        printf("Horário inválido. Use HH:MM (ex: 08:30) ou AAAA-MM-DDTHH:MM (ex: 2025-06-01T08:30): ");
+        limparBuffer();
+    }
+
+    printf("Prioridade (1 = mais urgente, 9 = menos urgente): ");
+    while (scanf("%d", &prioridade) != 1 || prioridade < 1 || prioridade > 9) {
+        printf("Entrada inválida. Digite um número de 1 a 9: ");
+        limparBuffer();
+    }
+    limparBuffer();
+
+    printf("\n");
+    registrarVoo(queue, registro, id, destino, empresa, modelo, assentos, horario, prioridade, stdout);
+}
+
+/**
+ * @brief Cria um voo com os dados informados, o adiciona à fila e grava seu arquivo JSON.
+ * Usada pelo menu e pelo modo script; as mensagens vão para out.
+ * @param queue Ponteiro para a fila de voos.
+ * @param registro Registro da aeronave (até 8 caracteres, também nomeia o arquivo).
+ * @param id ID do voo (até 7 caracteres).
+ * @param destino Código do destino (até 3 caracteres).
+ * @param empresa Nome da empresa (até 19 caracteres).
+ * @param modelo Modelo da aeronave (até 19 caracteres).
+ * @param assentos Quantidade de assentos (maior que 0).
+ * @param horario Data e hora previstas de decolagem, em minutos desde a época Unix.
+ * @param prioridade Prioridade de 1 (mais urgente) a 9.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o voo foi cadastrado, 0 caso contrário.
+ */
+int registrarVoo(QueuePlane* queue, const char* registro, const char* id, const char* destino,
+                 const char* empresa, const char* modelo, uint32_t assentos,
+                 uint32_t horario, int prioridade, FILE* out) {
+    pthread_rwlock_wrlock(&queue->trava);
+
+    // Id e Registro identificam o voo (o Registro também nomeia o arquivo JSON)
+    if (!registroValido(registro)) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Registro '%s' inválido (vazio, começando com '.' ou com '/'). Cadastro cancelado.\n", registro);
+        return 0;
+    }
+    if (encontrarVoo(queue, id) != NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Já existe um voo com o ID %s na fila. Cadastro cancelado.\n", id);
+        return 0;
+    }
+    if (encontrarVooPorRegistro(queue, registro) != NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "A aeronave %s já está na fila. Cadastro cancelado.\n", registro);
+        return 0;
+    }
+
+    Voo* newVoo = (Voo*)malloc(sizeof(Voo));
+    if(newVoo == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Não foi possível alocar memória para um novo voo.\n");
+        return 0;
+    }
+    snprintf(newVoo->Registro, sizeof(newVoo->Registro), "%s", registro);
+    snprintf(newVoo->Id, sizeof(newVoo->Id), "%s", id);
+    snprintf(newVoo->Destino, sizeof(newVoo->Destino), "%s", destino);
+    snprintf(newVoo->Empresa, sizeof(newVoo->Empresa), "%s", empresa);
+    snprintf(newVoo->Modelo, sizeof(newVoo->Modelo), "%s", modelo);
+    newVoo->Assentos = assentos;
+    newVoo->Horario = horario;
+    newVoo->Prioridade = (uint8_t)prioridade;
+    newVoo->lp = NULL;
+    newVoo->totalPassageiros = 0;
+    newVoo->journal = NULL;
+    newVoo->registrosJournal = 0;
+    newVoo->Sequencia = queue->proximaSequencia;
+    queue->proximaSequencia += ESPACO_SEQUENCIA;
+
+    enfileirarVoo(queue, newVoo);
+    fprintf(out, "Voo %s cadastrado com sucesso!\n", newVoo->Id);
+
+    // Snapshot inicial; um journal antigo com o mesmo registro não vale para este voo.
+    // Ainda com a fila em escrita, ninguém alcança o voo antes do arquivo existir
+    if (persistenciaAtiva) {
+        char filename[20];
+        snprintf(filename, sizeof(filename), "%s.journal", newVoo->Registro);
+        remove(filename);
+        if (salvarVooEmJson(newVoo))
+            fprintf(out, "Dados do voo %s salvos em '%s.json'.\n", newVoo->Id, newVoo->Registro);
+    }
+    pthread_rwlock_unlock(&queue->trava);
+    return 1;
+}
+
+/**
+ * @brief Coloca um voo novo na fila, na posição dada pelo horário e pela prioridade,
+ * e nos índices por Id e por Registro.
+ * Deve ser chamada com a trava da fila em escrita (ou antes de haver outras threads);
+ * é aqui que a trava do voo é criada.
+ * @param queue Ponteiro para a fila de voos.
+ * @param voo Voo a ser enfileirado.
+ */
+void enfileirarVoo(QueuePlane* queue, Voo* voo) {
+    pthread_mutex_init(&voo->trava, NULL);
+    colocarNaFila(queue, voo);
+}
+
+// Apaga o snapshot e o journal de um voo que saiu da fila. Chamada ainda com a
+// fila em escrita, para não apagar os arquivos de um voo novo com o mesmo registro
+static void apagarArquivosDoVoo(Voo* voo, FILE* out) {
+    fecharJournal(voo);
+    if (!persistenciaAtiva) return;
+
+    char filename[20];
+    sprintf(filename, "%s.json", voo->Registro);
+    if (remove(filename) == 0) {
+        fprintf(out, "Arquivo '%s' de registro do voo foi removido.\n", filename);
+    } else {
+        perror("Erro ao remover o arquivo do voo");
+    }
+    sprintf(filename, "%s.journal", voo->Registro);
+    remove(filename); // Pode não existir se o voo nunca foi alterado
+}
+
+// Libera um voo que já saiu da fila e que ninguém mais alcança
+static void destruirVoo(Voo* voo) {
+    pthread_mutex_destroy(&voo->trava);
+    liberarPassageiros(voo->lp);
+    free(voo);
+}
+
+/**
+ * @brief Simula decolagem, removendo o voo da fila, sua memória e seu arquivo JSON.
+ * @param queue Ponteiro para a fila de voos.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se um voo decolou, 0 se a fila estava vazia.
+ */
+int autorizarDecolagem(QueuePlane* queue, FILE* out) {
+    pthread_rwlock_wrlock(&queue->trava);
+    if (queue->front == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Nenhum voo na fila para decolagem.\n");
+        return 0;
+    }
+
+    Voo* decolando = queue->front;
+    retirarDaFila(queue, decolando);
+
+    fprintf(out, "Autorizando decolagem do Voo %s, destino %s.\n", decolando->Id, decolando->Destino);
+    apagarArquivosDoVoo(decolando, out);
+    pthread_rwlock_unlock(&queue->trava);
+
+    // Fora da fila e sem ninguém dentro dele (a trava estava em escrita): o voo é só nosso
+    destruirVoo(decolando);
+
+    fprintf(out, "Voo decolou. Fila e arquivos atualizados.\n");
+    return 1;
+}
+
+/**
+ * @brief Cancela um voo em qualquer posição da fila, em O(log n), liberando seus
+ * passageiros e apagando seus arquivos.
+ * @param queue Ponteiro para a fila de voos.
+ * @param id ID do voo.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o voo foi cancelado, 0 se não existe.
+ */
+int cancelarVoo(QueuePlane* queue, const char* id, FILE* out) {
+    pthread_rwlock_wrlock(&queue->trava);
+    Voo* voo = encontrarVoo(queue, id);
+    if (voo == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Voo com ID %s não encontrado.\n", id);
+        return 0;
+    }
+
+    retirarDaFila(queue, voo);
+    apagarArquivosDoVoo(voo, out);
+    pthread_rwlock_unlock(&queue->trava);
+
+    fprintf(out, "Voo %s cancelado (%u passageiro(s) liberado(s)).\n", voo->Id, voo->totalPassageiros);
+    destruirVoo(voo);
+    return 1;
+}
+
+/**
+ * @brief Pergunta no terminal o voo, o novo horário e a nova prioridade, e o reprograma.
+ * @param queue Ponteiro para a fila de voos.
+ */
+void gerenciarReprogramacao(QueuePlane* queue) {
+    char idVoo[8], textoHorario[20];
+    uint32_t horario;
+    int prioridade;
+
+    printf("Digite o ID do voo a ser reprogramado: ");
+    scanf("%7s", idVoo);
+
+    printf("Novo horário de decolagem (HH:MM ou AAAA-MM-DDTHH:MM): ");
+    while (scanf("%19s", textoHorario) != 1 || !lerHorario(textoHorario, &horario)) {
+        printf("Horário inválido. Use HH:MM (ex: 08:30) ou AAAA-MM-DDTHH:MM (ex: 2025-06-01T08:30): ");
+        limparBuffer();
+    }
+
+    printf("Nova prioridade (1 = mais urgente, 9 = menos urgente): ");
+    while (scanf("%d", &prioridade) != 1 || prioridade < 1 || prioridade > 9) {
+        printf("Entrada inválida. Digite um número de 1 a 9: ");
+        limparBuffer();
+    }
+    limparBuffer();
+
+    printf("\n");
+    reprogramarVoo(queue, idVoo, horario, prioridade, stdout);
+}
+
+/**
+ * @brief Pergunta no terminal o ID de um voo e o cancela.
+ * @param queue Ponteiro para a fila de voos.
+ */
+void gerenciarCancelamento(QueuePlane* queue) {
+    char idVoo[8];
+    printf("Digite o ID do voo a ser cancelado: ");
+    scanf("%7s", idVoo);
+
+    printf("\n");
+    cancelarVoo(queue, idVoo, stdout);
+}
+
+/**
+ * @brief Pergunta no terminal o voo a mover e o voo de referência, e o move.
+ * @param queue Ponteiro para a fila de voos.
+ * @param depois 1 para colocar o voo logo depois da referência, 0 para logo antes.
+ */
+void gerenciarMovimentacao(QueuePlane* queue, int depois) {
+    char idVoo[8], idReferencia[8];
+    printf("Digite o ID do voo a ser movido: ");
+    scanf("%7s", idVoo);
+    printf("Digite o ID do voo que ele deve decolar %s: ", depois ? "depois de" : "antes de");
+    scanf("%7s", idReferencia);
+
+    printf("\n");
+    moverVoo(queue, idVoo, idReferencia, depois, stdout);
+}
+
+/**
+ * @brief Exibe o próximo voo na fila e suas informações.
+ * @param queue Ponteiro para a fila de voos.
+ * @param out Onde escrever as informações.
+ */
+void listarPrimeiroVoo(QueuePlane* queue, FILE* out) {
+    pthread_rwlock_rdlock(&queue->trava);
+    if (queue->front == NULL) {
+        fprintf(out, "Nenhum voo na fila.\n");
+    } else {
+        Voo* p = queue->front;
+        char horario[20];
+        formatarHorario(p->Horario, horario, sizeof(horario));
+        fprintf(out, "--- PRÓXIMO VOO A DECOLAR ---\n");
+        fprintf(out, "ID: %s\nRegistro: %s\nDestino: %s\nEmpresa: %s\nAeronave: %s\nAssentos: %u\n",
+            p->Id, p->Registro, p->Destino, p->Empresa, p->Modelo, p->Assentos);
+        fprintf(out, "Horário: %s\nPrioridade: %u\n", horario, p->Prioridade);
+    }
+    pthread_rwlock_unlock(&queue->trava);
+}
+
+/**
+ * @brief Lista todos os voos na ordem de decolagem, exibindo suas informações.
+ * @param queue Ponteiro para a fila de voos.
+ * @param out Onde escrever as informações.
+ */
+void listarTodosVoos(QueuePlane* queue, FILE* out) {
+    pthread_rwlock_rdlock(&queue->trava);
+    if (queue->front == NULL) {
+        fprintf(out, "Fila de voos está vazia.\n");
+    } else {
+        Voo* atual = queue->front;
+        int pos = 1;
+        char horario[20];
+        fprintf(out, "--- FILA DE VOOS PARA DECOLAGEM ---\n");
+        while (atual != NULL) {
+            formatarHorario(atual->Horario, horario, sizeof(horario));
+            fprintf(out, "%d. Voo %s | Registro: %s | Destino: %s | Horário: %s | Prioridade: %u\n",
+                    pos++, atual->Id, atual->Registro, atual->Destino, horario, atual->Prioridade);
+            atual = atual->prox;
+        }
+    }
+    pthread_rwlock_unlock(&queue->trava);
+}
+
+/**
+ * @brief Exibe a quantidade de voos na fila, em O(1).
+ * @param queue Ponteiro para a fila de voos.
+ * @param out Onde escrever as informações.
+ */
+void contarVoos(QueuePlane* queue, FILE* out) {
+    pthread_rwlock_rdlock(&queue->trava);
+    size_t count = queue->quantidade;
+    pthread_rwlock_unlock(&queue->trava);
+    if (count == 0)
+        fprintf(out, "Não há voos na fila.\n");
+    else if (count == 1)
+        fprintf(out, "Há 1 voo na fila.\n");
+    else
+        fprintf(out, "Há %zu voos na fila.\n", count);
+}
+
+/**
+ * @brief Deixa uma fila recém-alocada vazia, com os índices e a trava prontos.
+ * @param queue Ponteiro para a fila de voos.
+ */
+void inicializarFila(QueuePlane* queue) {
+    queue->front = NULL;
+    queue->rear = NULL;
+    queue->raiz = NULL;
+    queue->quantidade = 0;
+    queue->proximaSequencia = ESPACO_SEQUENCIA;
+    inicializarIndice(&queue->porId, offsetof(Voo, Id));
+    inicializarIndice(&queue->porRegistro, offsetof(Voo, Registro));
+    pthread_rwlock_init(&queue->trava, NULL);
+}
+
+/**
+ * @brief Libera toda a memória alocada para a fila de voos e seus elementos.
+ * @param queue Ponteiro duplo para a fila de voos, que será setado como NULL após a liberação.
+ */
+void liberarFila(QueuePlane** queue) {
+    if (queue == NULL || *queue == NULL) return;
+    Voo* atual = (*queue)->front;
+    while(atual != NULL) {
+        Voo* temp = atual;
+        atual = atual->prox;
+        fecharJournal(temp); // O journal fica em disco para a próxima execução
+        pthread_mutex_destroy(&temp->trava);
+        liberarPassageiros(temp->lp);
+        free(temp);
+    }
+    liberarIndice(&(*queue)->porId);
+    liberarIndice(&(*queue)->porRegistro);
+    pthread_rwlock_destroy(&(*queue)->trava);
+    free(*queue);
+    *queue = NULL;
+}
+
+// =================== AGENDA DE DECOLAGENS ===================
+
+/**
+ * @brief Ordem de decolagem: horário, depois prioridade (menor primeiro), depois
+ * ordem de chegada. O registro só desempata voos antigos sem sequência gravada.
+ * @return Negativo se a decola antes de b, positivo se depois, 0 se é o mesmo voo.
+ */
+static int compararPosicao(const Voo* a, const Voo* b) {
+    if (a->Horario != b->Horario) return a->Horario < b->Horario ? -1 : 1;
+    if (a->Prioridade != b->Prioridade) return a->Prioridade < b->Prioridade ? -1 : 1;
+    if (a->Sequencia != b->Sequencia) return a->Sequencia < b->Sequencia ? -1 : 1;
+    return strcmp(a->Registro, b->Registro);
+}
+
+static int alturaVoo(Voo* voo) {
+    return voo ? voo->alturaAgenda : 0;
+}
+
+static void atualizarAlturaVoo(Voo* voo) {
+    int altEsq = alturaVoo(voo->esq);
+    int altDir = alturaVoo(voo->dir);
+    voo->alturaAgenda = 1 + (altEsq > altDir ? altEsq : altDir);
+}
+
+static Voo* rotacaoVooDireita(Voo* y) {
+    Voo* x = y->esq;
+    y->esq = x->dir;
+    x->dir = y;
+    atualizarAlturaVoo(y);
+    atualizarAlturaVoo(x);
+    return x;
+}
+
+static Voo* rotacaoVooEsquerda(Voo* x) {
+    Voo* y = x->dir;
+    x->dir = y->esq;
+    y->esq = x;
+    atualizarAlturaVoo(x);
+    atualizarAlturaVoo(y);
+    return y;
+}
+
+// Mesmas regras de balancear(), para a árvore de voos
+static Voo* balancearVoo(Voo* voo) {
+    atualizarAlturaVoo(voo);
+    int fator = alturaVoo(voo->esq) - alturaVoo(voo->dir);
+
+    if (fator > 1) {
+        if (alturaVoo(voo->esq->esq) < alturaVoo(voo->esq->dir))
+            voo->esq = rotacaoVooEsquerda(voo->esq);
+        return rotacaoVooDireita(voo);
+    }
+    if (fator < -1) {
+        if (alturaVoo(voo->dir->dir) < alturaVoo(voo->dir->esq))
+            voo->dir = rotacaoVooDireita(voo->dir);
+        return rotacaoVooEsquerda(voo);
+    }
+    return voo;
+}
+
+// Insere na árvore e devolve os vizinhos em ordem (último passo à direita e à esquerda)
+static Voo* inserirNaAgenda(Voo* raiz, Voo* voo, Voo** anterior, Voo** seguinte) {
+    if (raiz == NULL) {
+        voo->esq = voo->dir = NULL;
+        voo->alturaAgenda = 1;
+        return voo;
+    }
+    if (compararPosicao(voo, raiz) < 0) {
+        *seguinte = raiz;
+        raiz->esq = inserirNaAgenda(raiz->esq, voo, anterior, seguinte);
+    } else {
+        *anterior = raiz;
+        raiz->dir = inserirNaAgenda(raiz->dir, voo, anterior, seguinte);
+    }
+    return balancearVoo(raiz);
+}
+
+// Tira o menor nó da subárvore (que é o próprio sucessor já conhecido pelo fio)
+static Voo* removerMenorDaAgenda(Voo* raiz) {
+    if (raiz->esq == NULL) return raiz->dir;
+    raiz->esq = removerMenorDaAgenda(raiz->esq);
+    return balancearVoo(raiz);
+}
+
+// Remove o nó do voo religando os nós, sem copiar dados (o Voo é o próprio nó)
+static Voo* removerDaAgenda(Voo* raiz, Voo* voo) {
+    if (raiz == NULL) return NULL;
+
+    int cmp = compararPosicao(voo, raiz);
+    if (cmp < 0) {
+        raiz->esq = removerDaAgenda(raiz->esq, voo);
+    } else if (cmp > 0) {
+        raiz->dir = removerDaAgenda(raiz->dir, voo);
+    } else {
+        if (raiz->esq == NULL) return raiz->dir;
+        if (raiz->dir == NULL) return raiz->esq;
+
+        // Dois filhos: o sucessor em ordem (voo->prox) assume o lugar do nó
+        Voo* sucessor = raiz->prox;
+        sucessor->dir = removerMenorDaAgenda(raiz->dir);
+        sucessor->esq = raiz->esq;
+        raiz = sucessor;
+    }
+    return balancearVoo(raiz);
+}
+
+/**
+ * @brief Coloca um voo na agenda, no fio de decolagem e nos índices, em O(log n).
+ * Deve ser chamada com a trava da fila em escrita (ou antes de haver outras threads).
+ * @param queue Ponteiro para a fila de voos.
+ * @param voo Voo que ainda não está na fila.
+ */
+void colocarNaFila(QueuePlane* queue, Voo* voo) {
+    Voo* anterior = NULL;
+    Voo* seguinte = NULL;
+    queue->raiz = inserirNaAgenda(queue->raiz, voo, &anterior, &seguinte);
+
+    voo->ant = anterior;
+    voo->prox = seguinte;
+    if (anterior != NULL) anterior->prox = voo;
+    else queue->front = voo;
+    if (seguinte != NULL) seguinte->ant = voo;
+    else queue->rear = voo;
+    queue->quantidade++;
+
+    indiceInserir(&queue->porId, voo);
+    indiceInserir(&queue->porRegistro, voo);
+}
+
+/**
+ * @brief Tira um voo da agenda, do fio de decolagem e dos índices. O fio e os
+ * índices saem em O(1); só a árvore custa O(log n).
+ * Deve ser chamada com a trava da fila em escrita; o voo continua alocado.
+ * @param queue Ponteiro para a fila de voos.
+ * @param voo Voo que está na fila.
+ */
+void retirarDaFila(QueuePlane* queue, Voo* voo) {
+    if (voo->ant != NULL) voo->ant->prox = voo->prox;
+    else queue->front = voo->prox;
+    if (voo->prox != NULL) voo->prox->ant = voo->ant;
+    else queue->rear = voo->ant;
+    queue->quantidade--;
+
+    // removerDaAgenda ainda usa voo->prox como sucessor
+    queue->raiz = removerDaAgenda(queue->raiz, voo);
+    voo->prox = voo->ant = NULL;
+    indiceRemover(&queue->porId, voo);
+    indiceRemover(&queue->porRegistro, voo);
+}
+
+/**
+ * @brief Converte um horário digitado em minutos desde a época Unix.
+ * Aceita "HH:MM" (a próxima vez que o relógio local marcar essa hora: hoje, ou
+ * amanhã se já passou), "AAAA-MM-DDTHH:MM" (hora local) e "AAAA-MM-DDTHH:MMZ" (UTC,
+ * o formato gravado no JSON).
+ * @param texto Horário em um dos formatos acima.
+ * @param minutos Recebe o horário em minutos desde a época.
+ * @return 1 se o texto é um horário válido, 0 caso contrário.
+ */
+int lerHorario(const char* texto, uint32_t* minutos) {
+    unsigned int ano, mes, dia, horas, mins;
+    char sufixo = '\0', resto;
+    struct tm data;
+    time_t instante;
+
+    if (sscanf(texto, "%2u:%2u%c", &horas, &mins, &resto) == 2) {
+        if (horas > 23 || mins > 59) return 0;
+        time_t agora = time(NULL);
+        localtime_r(&agora, &data);
+        if ((unsigned int)(data.tm_hour * 60 + data.tm_min) > horas * 60 + mins) data.tm_mday++;
+        data.tm_hour = (int)horas;
+        data.tm_min = (int)mins;
+        data.tm_sec = 0;
+        data.tm_isdst = -1;
+        instante = mktime(&data);
+    } else {
+        int lidos = sscanf(texto, "%4u-%2u-%2uT%2u:%2u%c%c", &ano, &mes, &dia, &horas, &mins, &sufixo, &resto);
+        if ((lidos != 5 && !(lidos == 6 && sufixo == 'Z')) || ano < 1970
+            || mes < 1 || mes > 12 || dia < 1 || dia > 31 || horas > 23 || mins > 59) return 0;
+        memset(&data, 0, sizeof(data));
+        data.tm_year = (int)ano - 1900;
+        data.tm_mon = (int)mes - 1;
+        data.tm_mday = (int)dia;
+        data.tm_hour = (int)horas;
+        data.tm_min = (int)mins;
+        data.tm_isdst = -1;
+        instante = sufixo == 'Z' ? timegm(&data) : mktime(&data);
+        if (data.tm_mday != (int)dia) return 0; // 31/04 e afins viram o mês seguinte
+    }
+
+    if (instante < 0 || instante / 60 > UINT32_MAX) return 0;
+    *minutos = (uint32_t)(instante / 60);
+    return 1;
+}
+
+/**
+ * @brief Escreve um horário da agenda como "AAAA-MM-DD HH:MM", na hora local.
+ * @param minutos Minutos desde a época Unix.
+ * @param destino Onde escrever o texto.
+ * @param tamanho Tamanho de destino (17 bytes bastam).
+ */
+void formatarHorario(uint32_t minutos, char* destino, size_t tamanho) {
+    time_t instante = (time_t)minutos * 60;
+    struct tm data;
+    localtime_r(&instante, &data);
+    strftime(destino, tamanho, "%Y-%m-%d %H:%M", &data);
+}
+
+/**
+ * @brief Minuto atual, na mesma escala de Voo.Horario.
+ */
+uint32_t minutosAgora(void) {
+    return (uint32_t)(time(NULL) / 60);
+}
+
+/**
+ * @brief Muda o horário e a prioridade de um voo e o recoloca na agenda, em O(log n).
+ * A ordem de chegada é mantida, então voos com o mesmo horário e prioridade
+ * continuam na ordem em que foram cadastrados.
+ * @param queue Ponteiro para a fila de voos.
+ * @param id ID do voo.
+ * @param horario Novo horário, em minutos desde a época Unix.
+ * @param prioridade Nova prioridade (1 = mais urgente, 9 = menos urgente), ou negativa para manter a atual.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o voo foi reprogramado, 0 se não existe.
+ */
+int reprogramarVoo(QueuePlane* queue, const char* id, uint32_t horario, int prioridade, FILE* out) {
+    pthread_rwlock_wrlock(&queue->trava);
+    Voo* voo = encontrarVoo(queue, id);
+    if (voo == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Voo com ID %s não encontrado.\n", id);
+        return 0;
+    }
+
+    retirarDaFila(queue, voo);
+    voo->Horario = horario;
+    if (prioridade > 0) voo->Prioridade = (uint8_t)prioridade;
+    colocarNaFila(queue, voo);
+
+    // Uma linha no journal em vez de reescrever o snapshot com todos os passageiros
+    registrarAgendamento(voo);
+    unsigned int prioridadeAtual = voo->Prioridade;
+    pthread_rwlock_unlock(&queue->trava);
+
+    char texto[20];
+    formatarHorario(horario, texto, sizeof(texto));
+    fprintf(out, "Voo %s reprogramado para %s, prioridade %u.\n", id, texto, prioridadeAtual);
+    return 1;
+}
+
+// Mesmo horário e mesma prioridade: só a sequência decide entre os dois
+static int mesmoAgendamento(const Voo* a, const Voo* b) {
+    return a != NULL && b != NULL && a->Horario == b->Horario && a->Prioridade == b->Prioridade;
+}
+
+// Densidade máxima de uma faixa de sequências reetiquetada: a cada vez que a
+// faixa dobra de tamanho, ela precisa ter 1,5x mais folga por voo
+#define FOLGA_POR_NIVEL 1.5
+
+// Abre espaço em volta da referência (list labeling): procura a menor faixa
+// alinhada de sequências que contém a referência e ainda tem folga, e espalha
+// por igual só os voos do mesmo agendamento dentro dela. A ordem entre eles não
+// muda e ninguém sai da faixa, então a árvore continua válida sem reinserções;
+// o custo amortizado é O(log n) voos, cada um com uma linha no journal
+static void reetiquetarEmVolta(QueuePlane* queue, Voo* referencia) {
+    Voo* primeiro = referencia;
+    Voo* ultimo = referencia;
+    uint64_t quantidade = 1;
+    uint64_t inicio = referencia->Sequencia;
+    uint64_t tamanho = 1;
+    double folga = 1.0;
+
+    for (int nivel = 1; nivel < 63; nivel++) {
+        tamanho <<= 1;
+        folga *= FOLGA_POR_NIVEL;
+        inicio = referencia->Sequencia & ~(tamanho - 1);
+
+        // As faixas são encaixadas, então a janela só cresce para os lados
+        while (mesmoAgendamento(primeiro->ant, referencia) && primeiro->ant->Sequencia >= inicio) {
+            primeiro = primeiro->ant;
+            quantidade++;
+        }
+        while (mesmoAgendamento(ultimo->prox, referencia) && ultimo->prox->Sequencia - inicio < tamanho) {
+            ultimo = ultimo->prox;
+            quantidade++;
+        }
+
+        // Cabe mais um voo, com pelo menos 2 de distância entre vizinhos
+        if (tamanho >= 2 * (quantidade + 1) && (double)(quantidade + 1) * folga <= (double)tamanho) break;
+    }
+
+    uint64_t passo = tamanho / (quantidade + 1);
+    uint64_t sequencia = inicio;
+    for (Voo* voo = primeiro; ; voo = voo->prox) {
+        sequencia += passo;
+        voo->Sequencia = sequencia;
+        registrarAgendamento(voo);
+        if (voo == ultimo) break;
+    }
+    // Quem chegar depois continua atrás de todos
+    if (sequencia >= queue->proximaSequencia) queue->proximaSequencia = sequencia + ESPACO_SEQUENCIA;
+}
+
+// Sequência que encaixa um voo com o agendamento da referência logo antes
+// (ou logo depois) dela; sem espaço entre os vizinhos, abre espaço em volta antes
+static uint64_t sequenciaAoLado(QueuePlane* queue, Voo* referencia, int depois) {
+    while (1) {
+        uint64_t baixo, alto;
+        if (depois) {
+            baixo = referencia->Sequencia;
+            alto = mesmoAgendamento(referencia->prox, referencia) ? referencia->prox->Sequencia
+                                                                   : queue->proximaSequencia;
+        } else {
+            alto = referencia->Sequencia;
+            baixo = mesmoAgendamento(referencia->ant, referencia) ? referencia->ant->Sequencia : 0;
+        }
+        if (alto > baixo && alto - baixo >= 2) return baixo + (alto - baixo) / 2;
+        reetiquetarEmVolta(queue, referencia);
+    }
+}
+
+/**
+ * @brief Move um voo para logo antes (ou logo depois) de outro na ordem de decolagem.
+ * O voo movido assume o horário e a prioridade da referência e uma sequência entre
+ * ela e o vizinho; o fio muda em O(1), a árvore em O(log n) e o disco recebe uma
+ * linha de journal por voo que mudou de sequência.
+ * @param queue Ponteiro para a fila de voos.
+ * @param id ID do voo a ser movido.
+ * @param idReferencia ID do voo ao lado do qual ele vai ficar.
+ * @param depois 1 para decolar logo depois da referência, 0 para logo antes.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o voo foi movido, 0 se algum dos voos não existe.
+ */
+int moverVoo(QueuePlane* queue, const char* id, const char* idReferencia, int depois, FILE* out) {
+    pthread_rwlock_wrlock(&queue->trava);
+    Voo* voo = encontrarVoo(queue, id);
+    Voo* referencia = encontrarVoo(queue, idReferencia);
+    if (voo == NULL || referencia == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Voo com ID %s não encontrado.\n", voo == NULL ? id : idReferencia);
+        return 0;
+    }
+    if (voo == referencia) {
+        pthread_rwlock_unlock(&queue->trava);
+        fprintf(out, "Um voo não pode ser movido para perto dele mesmo.\n");
+        return 0;
+    }
+
+    retirarDaFila(queue, voo);
+    voo->Horario = referencia->Horario;
+    voo->Prioridade = referencia->Prioridade;
+    voo->Sequencia = sequenciaAoLado(queue, referencia, depois);
+    colocarNaFila(queue, voo);
+
+    registrarAgendamento(voo);
+    uint32_t horario = voo->Horario;
+    unsigned int prioridade = voo->Prioridade;
+    pthread_rwlock_unlock(&queue->trava);
+
+    char texto[20];
+    formatarHorario(horario, texto, sizeof(texto));
+    fprintf(out, "Voo %s movido para %s do voo %s (%s, prioridade %u).\n",
+            id, depois ? "depois" : "antes", idReferencia, texto, prioridade);
+    return 1;
+}
+
+// =================== FUNÇÕES DE PASSAGEIROS ===================
+
+/**
+ * @brief Monta a chave de comparação de um nome (minúsculas, zeros à direita e prefixo).
+ * @param chave Ponteiro para a chave a ser preenchida.
+ * @param name Nome do passageiro (só os 39 primeiros caracteres contam, como no cadastro).
+ */
+void montarChavePassageiro(ChavePassageiro* chave, const char* name) {
+    size_t i = 0;
+    for (; i < sizeof(chave->chave) - 1 && name[i] != '\0'; i++) {
+        chave->chave[i] = (char)tolower((unsigned char)name[i]);
+    }
+    memset(chave->chave + i, 0, sizeof(chave->chave) - i);
+
+    chave->prefixo = 0;
+    for (i = 0; i < 8; i++) {
+        chave->prefixo = (chave->prefixo << 8) | (unsigned char)chave->chave[i];
+    }
+}
+
+// Equivale a strcasecmp nos nomes originais: quase sempre decide pelo prefixo,
+// e só compara o resto da string quando os 8 primeiros bytes empatam
+static int compararChaves(const ChavePassageiro* a, const ChavePassageiro* b) {
+    if (a->prefixo != b->prefixo) return a->prefixo < b->prefixo ? -1 : 1;
+    return strcmp(a->chave + 8, b->chave + 8);
+}
+
+// Inserção AVL recursiva com a chave já montada
+static PassengersList* inserirPorChave(PassengersList* root, const char* name, const ChavePassageiro* chave,
+                                       uint32_t* total) {
+    if (root == NULL) {
+        PassengersList* newP = (PassengersList*)malloc(sizeof(PassengersList));
+        if (newP == NULL) {
+            printf("Falha na alocação.\n");
+            return root;
+        }
+        strncpy(newP->name, name, sizeof(newP->name) - 1);
+        newP->name[sizeof(newP->name) - 1] = '\0';
+        newP->chave = *chave;
+        newP->left = newP->right = NULL;
+        newP->altura = 1;
+        (*total)++;
+        return newP;
+    }
+    // Uma única comparação por nível
+    int cmp = compararChaves(chave, &root->chave);
+    if (cmp < 0)
+        root->left = inserirPorChave(root->left, name, chave, total);
+    else if (cmp > 0)
+        root->right = inserirPorChave(root->right, name, chave, total);
+    else
+        return root; // Já cadastrado
+    return balancear(root);
+}
+
+// Remoção AVL recursiva com a chave já montada
+static PassengersList* removerPorChave(PassengersList* root, const ChavePassageiro* chave, uint32_t* total) {
+    if (root == NULL) return root;
+    int cmp = compararChaves(chave, &root->chave);
+    if (cmp < 0)
+        root->left = removerPorChave(root->left, chave, total);
+    else if (cmp > 0)
+        root->right = removerPorChave(root->right, chave, total);
+    else {
+        if (root->left == NULL) {
+            PassengersList* temp = root->right;
+            free(root);
+            (*total)--;
+            return temp;
+        } else if (root->right == NULL) {
+            PassengersList* temp = root->left;
+            free(root);
+            (*total)--;
+            return temp;
+        }
+        PassengersList* temp = encontrarMinimo(root->right);
+        memcpy(root->name, temp->name, sizeof(root->name));
+        root->chave = temp->chave;
+        root->right = removerPorChave(root->right, &root->chave, total);
+    }
+    return balancear(root);
+}
+
+/**
+ * @brief Cadastra um novo passageiro na árvore AVL de passageiros do voo, em O(log n).
+ * Protege contra buffer overflow e excesso de passageiros. Nomes repetidos são ignorados
+ * (sem diferenciar maiúsculas de minúsculas).
+ * @param root Raiz da árvore de passageiros.
+ * @param name Nome do passageiro a ser cadastrado.
+ * @param total Ponteiro para o total de passageiros já cadastrados.
+ * @param max Número máximo de assentos disponíveis.
+ * @return Retorna a nova raiz da árvore (pode ser a mesma ou um novo nó).
+ */
+PassengersList* cadastrarPassageiro(PassengersList* root, char* name, uint32_t* total, uint32_t max) {
+    if (*total >= max) {
+        printf("Limite de passageiros atingido para este voo.\n");
+        return root;
+    }
+    ChavePassageiro chave;
+    montarChavePassageiro(&chave, name);
+    return inserirPorChave(root, name, &chave, total);
+}
+
+/**
+ * @brief Remove um passageiro da árvore AVL de passageiros do voo, em O(log n).
+ * @param root Raiz da árvore de passageiros.
+ * @param name Nome do passageiro a ser removido.
+ * @param total Ponteiro para o total de passageiros já cadastrados.
+ * @return Retorna a nova raiz da árvore (pode ser a mesma ou um novo nó).
+ */
+PassengersList* removerPassageiro(PassengersList* root, char* name, uint32_t* total) {
+    ChavePassageiro chave;
+    montarChavePassageiro(&chave, name);
+    return removerPorChave(root, &chave, total);
+}
+
+/**
+ * @brief Busca um passageiro pelo nome (sem diferenciar maiúsculas), em O(log n).
+ * @param root Raiz da árvore de passageiros.
+ * @param name Nome do passageiro.
+ * @return Ponteiro para o nó do passageiro ou NULL.
+ */
+PassengersList* buscarPassageiro(PassengersList* root, const char* name) {
+    ChavePassageiro chave;
+    montarChavePassageiro(&chave, name);
+    while (root != NULL) {
+        int cmp = compararChaves(&chave, &root->chave);
+        if (cmp == 0) return root;
+        root = cmp < 0 ? root->left : root->right;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Lista todos os passageiros em ordem alfabética.
+ * @param root Raiz da árvore de passageiros.
+ * @param out Onde escrever a lista.
+ */
+void listarPassageiros(PassengersList* root, FILE* out) {
+    if (root != NULL) {
+        listarPassageiros(root->left, out);
+        fprintf(out, "- %s\n", root->name);
+        listarPassageiros(root->right, out);
+    }
+}
+
+/**
+ * @brief Libera toda a memória alocada para a árvore de passageiros.
+ * @param root Raiz da árvore de passageiros.
+ */
+void liberarPassageiros(PassengersList* root) {
+    if (root != NULL) {
+        liberarPassageiros(root->left);
+        liberarPassageiros(root->right);
+        free(root);
+    }
+}
+
+/**
+ * @brief Retorna a altura de um nó da árvore de passageiros (0 para NULL).
+ * @param node Nó da árvore.
+ * @return Altura do nó.
+ */
+int alturaPassageiro(PassengersList* node) {
+    return node ? node->altura : 0;
+}
+
+// Recalcula a altura a partir dos filhos
+static void atualizarAltura(PassengersList* node) {
+    int altEsq = alturaPassageiro(node->left);
+    int altDir = alturaPassageiro(node->right);
+    node->altura = 1 + (altEsq > altDir ? altEsq : altDir);
+}
+
+/**
+ * @brief Rotação simples à direita: o filho esquerdo de y vira a raiz da subárvore.
+ * @param y Raiz da subárvore desbalanceada para a esquerda.
+ * @return Nova raiz da subárvore.
+ */
+PassengersList* rotacaoDireita(PassengersList* y) {
+    PassengersList* x = y->left;
+    y->left = x->right;
+    x->right = y;
+    atualizarAltura(y);
+    atualizarAltura(x);
+    return x;
+}
+
+/**
+ * @brief Rotação simples à esquerda: o filho direito de x vira a raiz da subárvore.
+ * @param x Raiz da subárvore desbalanceada para a direita.
+ * @return Nova raiz da subárvore.
+ */
+PassengersList* rotacaoEsquerda(PassengersList* x) {
+    PassengersList* y = x->right;
+    x->right = y->left;
+    y->left = x;
+    atualizarAltura(x);
+    atualizarAltura(y);
+    return y;
+}
+
+/**
+ * @brief Atualiza a altura do nó e aplica as rotações AVL necessárias.
+ * @param node Raiz de uma subárvore cujos filhos já estão balanceados.
+ * @return Nova raiz da subárvore.
+ */
+PassengersList* balancear(PassengersList* node) {
+    atualizarAltura(node);
+    int fator = alturaPassageiro(node->left) - alturaPassageiro(node->right);
+
+    if (fator > 1) {
+        // Caso esquerda-direita vira esquerda-esquerda
+        if (alturaPassageiro(node->left->left) < alturaPassageiro(node->left->right))
+            node->left = rotacaoEsquerda(node->left);
+        return rotacaoDireita(node);
+    }
+    if (fator < -1) {
+        if (alturaPassageiro(node->right->right) < alturaPassageiro(node->right->left))
+            node->right = rotacaoDireita(node->right);
+        return rotacaoEsquerda(node);
+    }
+    return node;
+}
+
+/**
+ * @brief Gerencia o cadastro de um passageiro em um voo (pergunta os dados no terminal).
+ * @param queue Ponteiro para a fila de voos.
+ */
+void gerenciarCadastroPassageiro(QueuePlane* queue) {
+    char idVoo[8];
+    printf("Digite o ID do voo para adicionar o passageiro: ");
+    scanf("%7s", idVoo);
+
+    Voo* vooAlvo = encontrarVoo(queue, idVoo);
+    if (vooAlvo == NULL) {
+        printf("Voo com ID %s não encontrado.\n", idVoo);
+        return;
+    }
+
+    if (vooAlvo->totalPassageiros >= vooAlvo->Assentos) {
+        printf("Todos os assentos deste voo já estão ocupados.\n");
+        return;
+    }
+
+    char nomePassageiro[40];
+    printf("Digite o nome completo do passageiro: ");
+    limparBuffer();
+    fgets(nomePassageiro, sizeof(nomePassageiro), stdin);
+    nomePassageiro[strcspn(nomePassageiro, "\n")] = 0;
+
+    embarcarPassageiro(queue, idVoo, nomePassageiro, stdout);
+}
+
+/**
+ * @brief Cadastra um passageiro em um voo e registra a alteração no journal.
+ * Protege contra excesso de passageiros e nomes repetidos.
+ * @param queue Ponteiro para a fila de voos.
+ * @param idVoo ID do voo.
+ * @param nomePassageiro Nome completo do passageiro (até 39 caracteres).
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o passageiro foi cadastrado, 0 caso contrário.
+ */
+int embarcarPassageiro(QueuePlane* queue, const char* idVoo, const char* nomePassageiro, FILE* out) {
+    Voo* vooAlvo = travarVoo(queue, idVoo);
+    if (vooAlvo == NULL) {
+        fprintf(out, "Voo com ID %s não encontrado.\n", idVoo);
+        return 0;
+    }
+    if (vooAlvo->totalPassageiros >= vooAlvo->Assentos) {
+        destravarVoo(queue, vooAlvo);
+        fprintf(out, "Todos os assentos deste voo já estão ocupados.\n");
+        return 0;
+    }
+
+    char nome[40];
+    snprintf(nome, sizeof(nome), "%s", nomePassageiro);
+
+    uint32_t antes = vooAlvo->totalPassageiros;
+    vooAlvo->lp = cadastrarPassageiro(vooAlvo->lp, nome, &vooAlvo->totalPassageiros, vooAlvo->Assentos);
+    int cadastrado = vooAlvo->totalPassageiros != antes;
+    if (cadastrado) registrarNoJournal(vooAlvo, 'A', nome);
+    destravarVoo(queue, vooAlvo);
+
+    if (!cadastrado) {
+        fprintf(out, "Passageiro '%s' já está cadastrado no voo %s.\n", nome, idVoo);
+        return 0;
+    }
+    fprintf(out, "Passageiro '%s' cadastrado no voo %s.\n", nome, idVoo);
+    return 1;
+}
+
+/**
+ * @brief Gerencia a remoção de um passageiro de um voo (pergunta os dados no terminal).
+ * @param queue Ponteiro para a fila de voos.
+ */
+void gerenciarRemocaoPassageiro(QueuePlane* queue) {
+    char idVoo[8];
+    printf("Digite o ID do voo para remover o passageiro: ");
+    scanf("%7s", idVoo);
+
+    if (encontrarVoo(queue, idVoo) == NULL) {
+        printf("Voo com ID %s não encontrado.\n", idVoo);
+        return;
+    }
+
+    char nomePassageiro[40];
+    printf("Digite o nome completo do passageiro a ser removido: ");
+    limparBuffer();
+    fgets(nomePassageiro, sizeof(nomePassageiro), stdin);
+    nomePassageiro[strcspn(nomePassageiro, "\n")] = 0;
+
+    desembarcarPassageiro(queue, idVoo, nomePassageiro, stdout);
+}
+
+/**
+ * @brief Remove um passageiro de um voo e registra a alteração no journal.
+ * @param queue Ponteiro para a fila de voos.
+ * @param idVoo ID do voo.
+ * @param nomePassageiro Nome completo do passageiro.
+ * @param out Onde escrever as mensagens.
+ * @return 1 se o passageiro foi removido, 0 caso contrário.
+ */
+int desembarcarPassageiro(QueuePlane* queue, const char* idVoo, const char* nomePassageiro, FILE* out) {
+    Voo* vooAlvo = travarVoo(queue, idVoo);
+    if (vooAlvo == NULL) {
+        fprintf(out, "Voo com ID %s não encontrado.\n", idVoo);
+        return 0;
+    }
+
+    char nome[40];
+    snprintf(nome, sizeof(nome), "%s", nomePassageiro);
+
+    uint32_t antes = vooAlvo->totalPassageiros;
+    vooAlvo->lp = removerPassageiro(vooAlvo->lp, nome, &vooAlvo->totalPassageiros);
+    int removido = vooAlvo->totalPassageiros != antes;
+    if (removido) registrarNoJournal(vooAlvo, 'R', nome);
+    destravarVoo(queue, vooAlvo);
+
+    if (!removido) {
+        fprintf(out, "Passageiro '%s' não encontrado no voo %s.\n", nome, idVoo);
+        return 0;
+    }
+    fprintf(out, "Passageiro '%s' removido do voo %s.\n", nome, idVoo);
+    return 1;
+}
+
+/**
+ * @brief Gerencia a listagem de passageiros de um voo (pergunta o ID no terminal).
+ * @param queue Ponteiro para a fila de voos.
+ */
+void gerenciarListagemPassageiros(QueuePlane* queue) {
+    char idVoo[8];
+    printf("Digite o ID do voo para listar os passageiros: ");
+    scanf("%7s", idVoo);
+
+    printf("\n");
+    mostrarPassageiros(queue, idVoo, stdout);
+}
+
+/**
+ * @brief Lista os passageiros de um voo em ordem alfabética.
+ * @param queue Ponteiro para a fila de voos.
+ * @param idVoo ID do voo.
+ * @param out Onde escrever a lista.
+ * @return 1 se o voo existe, 0 caso contrário.
+ */
+int mostrarPassageiros(QueuePlane* queue, const char* idVoo, FILE* out) {
+    Voo* vooAlvo = travarVoo(queue, idVoo);
+    if (vooAlvo == NULL) {
+        fprintf(out, "Voo com ID %s não encontrado.\n", idVoo);
+        return 0;
+    }
+
+    fprintf(out, "--- LISTA DE PASSAGEIROS DO VOO %s ---\n", idVoo);
+
+    if (vooAlvo->lp == NULL) {
+        fprintf(out, "Não há passageiros cadastrados neste voo.\n");
+    } else {
+        listarPassageiros(vooAlvo->lp, out);
+    }
+    destravarVoo(queue, vooAlvo);
+    return 1;
+}
+
+// =================== FUNÇÕES AUXILIARES ===================
+
+/**
+ * @brief Busca um voo pelo ID na fila (O(1) esperado, pelo índice hash).
+ * Não trava nada: quem chama já deve estar com a trava da fila (ou usar travarVoo).
+ * @param queue Ponteiro para a fila de voos.
+ * @param id ID do voo a ser buscado.
+ * @return Ponteiro para o voo encontrado ou NULL.
+ */
+Voo* encontrarVoo(QueuePlane* queue, const char* id) {
+    return indiceBuscar(&queue->porId, id);
+}
+
+/**
+ * @brief Busca um voo pelo registro da aeronave (O(1) esperado, pelo índice hash).
+ * @param queue Ponteiro para a fila de voos.
+ * @param registro Registro da aeronave (ex: PR-GUO).
+ * @return Ponteiro para o voo encontrado ou NULL.
+ */
+Voo* encontrarVooPorRegistro(QueuePlane* queue, const char* registro) {
+    return indiceBuscar(&queue->porRegistro, registro);
+}
+
+/**
+ * @brief Confere se o registro pode nomear os arquivos do voo (<Registro>.json,
+ * .journal e .json.tmp) sem sair do diretório atual nem virar um arquivo oculto.
+ * @param registro Registro da aeronave.
+ * @return 1 se não é vazio, não começa com '.' e não tem '/', 0 caso contrário.
+ */
+int registroValido(const char* registro) {
+    return registro[0] != '\0' && registro[0] != '.' && strchr(registro, '/') == NULL;
+}
+
+/**
+ * @brief Busca um voo pelo ID e trava os passageiros dele.
+ * A fila fica travada em leitura até destravarVoo, então o voo não pode decolar
+ * no meio da operação; outros voos continuam livres.
+ * @param queue Ponteiro para a fila de voos.
+ * @param id ID do voo.
+ * @return Ponteiro para o voo travado, ou NULL (sem nenhuma trava) se não existe.
+ */
+Voo* travarVoo(QueuePlane* queue, const char* id) {
+    pthread_rwlock_rdlock(&queue->trava);
+    Voo* voo = encontrarVoo(queue, id);
+    if (voo == NULL) {
+        pthread_rwlock_unlock(&queue->trava);
+        return NULL;
+    }
+    pthread_mutex_lock(&voo->trava);
+    return voo;
+}
+
+/**
+ * @brief Solta as travas pegas por travarVoo.
+ * @param queue Ponteiro para a fila de voos.
+ * @param voo Voo devolvido por travarVoo.
+ */
+void destravarVoo(QueuePlane* queue, Voo* voo) {
+    pthread_mutex_unlock(&voo->trava);
+    pthread_rwlock_unlock(&queue->trava);
+}
+
 /**
  * @brief Encontra o nó com o menor valor (nome) na árvore de passageiros.
  * @param node Raiz da árvore.
@@ -552,23 +2226,162 @@ void limparBuffer(void) {
     while ((c = getchar()) != '\n' && c != EOF);
 }
 
+// =================== ÍNDICE HASH DE VOOS ===================
+
+#define INDICE_CAPACIDADE_INICIAL 16
+
+// Chave de texto do voo segundo o índice
+static const char* chaveDoVoo(const IndiceVoos* indice, const Voo* voo) {
+    return (const char*)voo + indice->offsetChave;
+}
+
+// FNV-1a de 32 bits: simples e bom para chaves curtas como "G3-1234"
+static uint32_t hashChave(const char* chave) {
+    uint32_t hash = 2166136261u;
+    while (*chave) {
+        hash ^= (unsigned char)*chave++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static Voo** alocarSlots(size_t capacidade) {
+    Voo** slots = (Voo**)calloc(capacidade, sizeof(Voo*));
+    if (slots == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+    return slots;
+}
+
+// Coloca o voo na primeira posição livre a partir do seu hash (sem checar duplicata)
+static void colocarNoSlot(IndiceVoos* indice, Voo* voo) {
+    size_t mascara = indice->capacidade - 1;
+    size_t i = hashChave(chaveDoVoo(indice, voo)) & mascara;
+    while (indice->slots[i] != NULL) {
+        i = (i + 1) & mascara;
+    }
+    indice->slots[i] = voo;
+}
+
+/**
+ * @brief Inicializa um índice vazio.
+ * @param indice Ponteiro para o índice.
+ * @param offsetChave Deslocamento do campo-chave dentro de Voo (use offsetof).
+ */
+void inicializarIndice(IndiceVoos* indice, size_t offsetChave) {
+    indice->capacidade = INDICE_CAPACIDADE_INICIAL;
+    indice->quantidade = 0;
+    indice->offsetChave = offsetChave;
+    indice->slots = alocarSlots(indice->capacidade);
+}
+
+/**
+ * @brief Adiciona um voo ao índice, dobrando a tabela se passar de 70% de ocupação.
+ * @param indice Ponteiro para o índice.
+ * @param voo Voo a ser indexado (a chave não pode estar no índice).
+ */
+void indiceInserir(IndiceVoos* indice, Voo* voo) {
+    if ((indice->quantidade + 1) * 10 > indice->capacidade * 7) {
+        Voo** antigos = indice->slots;
+        size_t capacidadeAntiga = indice->capacidade;
+
+        indice->capacidade *= 2;
+        indice->slots = alocarSlots(indice->capacidade);
+        for (size_t i = 0; i < capacidadeAntiga; i++) {
+            if (antigos[i] != NULL) colocarNoSlot(indice, antigos[i]);
+        }
+        free(antigos);
+    }
+
+    colocarNoSlot(indice, voo);
+    indice->quantidade++;
+}
+
+/**
+ * @brief Retira um voo do índice.
+ * Usa remoção com deslocamento para trás, então não deixa marcadores de apagado.
+ * @param indice Ponteiro para o índice.
+ * @param voo Voo a ser retirado.
+ */
+void indiceRemover(IndiceVoos* indice, Voo* voo) {
+    size_t mascara = indice->capacidade - 1;
+    size_t i = hashChave(chaveDoVoo(indice, voo)) & mascara;
+
+    while (indice->slots[i] != voo) {
+        if (indice->slots[i] == NULL) return; // Não estava indexado
+        i = (i + 1) & mascara;
+    }
+
+    // Puxa para o buraco os elementos seguintes que não estão na posição ideal
+    size_t buraco = i;
+    size_t j = i;
+    while (1) {
+        j = (j + 1) & mascara;
+        if (indice->slots[j] == NULL) break;
+
+        size_t ideal = hashChave(chaveDoVoo(indice, indice->slots[j])) & mascara;
+        // Só move se `ideal` não estiver no trecho circular (buraco, j]
+        if (((j - ideal) & mascara) >= ((j - buraco) & mascara)) {
+            indice->slots[buraco] = indice->slots[j];
+            buraco = j;
+        }
+    }
+
+    indice->slots[buraco] = NULL;
+    indice->quantidade--;
+}
+
+/**
+ * @brief Busca um voo pela chave.
+ * @param indice Ponteiro para o índice.
+ * @param chave Chave procurada (Id ou Registro, conforme o índice).
+ * @return Ponteiro para o voo ou NULL.
+ */
+Voo* indiceBuscar(const IndiceVoos* indice, const char* chave) {
+    size_t mascara = indice->capacidade - 1;
+    size_t i = hashChave(chave) & mascara;
+
+    while (indice->slots[i] != NULL) {
+        if (strcmp(chave, chaveDoVoo(indice, indice->slots[i])) == 0)
+            return indice->slots[i];
+        i = (i + 1) & mascara;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Libera a tabela do índice (os voos não são liberados aqui).
+ * @param indice Ponteiro para o índice.
+ */
+void liberarIndice(IndiceVoos* indice) {
+    free(indice->slots);
+    indice->slots = NULL;
+    indice->capacidade = 0;
+    indice->quantidade = 0;
+}
+
 // =================== FUNÇÕES DE PERSISTÊNCIA ===================
 
 /**
  * @brief Salva os dados de um voo, incluindo sua lista de passageiros, em um arquivo JSON.
- * O nome do arquivo é o registro do voo (ex: PR-GUO.json).
+ * O nome do arquivo é o registro do voo (ex: PR-GUO.json). O arquivo é escrito num
+ * temporário e depois renomeado, então um snapshot nunca fica pela metade.
  * @param voo Ponteiro para o voo que será salvo.
+ * @return 1 se o snapshot novo está no lugar, 0 se o anterior (se houver) continua valendo.
  */
-void salvarVooEmJson(Voo* voo) {
-    if (voo == NULL) return;
+int salvarVooEmJson(Voo* voo) {
+    if (voo == NULL) return 0;
 
     char filename[20];
+    char tmpname[24];
     snprintf(filename, sizeof(filename), "%s.json", voo->Registro);
+    snprintf(tmpname, sizeof(tmpname), "%s.json.tmp", voo->Registro);
 
-    FILE* file = fopen(filename, "w");
+    FILE* file = fopen(tmpname, "w");
     if (file == NULL) {
-        printf("ERRO: Não foi possível criar o arquivo %s\n", filename);
-        return;
+        printf("ERRO: Não foi possível criar o arquivo %s\n", tmpname);
+        return 0;
     }
 
     fprintf(file, "{\n");
@@ -578,6 +2391,15 @@ void salvarVooEmJson(Voo* voo) {
     fprintf(file, "  \"empresa\": \"%s\",\n", voo->Empresa);
     fprintf(file, "  \"modelo_aeronave\": \"%s\",\n", voo->Modelo);
     fprintf(file, "  \"assentos\": %u,\n", voo->Assentos);
+    // Em UTC, para a mesma data valer em qualquer fuso e na troca do horário de verão
+    char horario[20];
+    time_t instante = (time_t)voo->Horario * 60;
+    struct tm data;
+    gmtime_r(&instante, &data);
+    strftime(horario, sizeof(horario), "%Y-%m-%dT%H:%MZ", &data);
+    fprintf(file, "  \"horario\": \"%s\",\n", horario);
+    fprintf(file, "  \"prioridade\": %u,\n", voo->Prioridade);
+    fprintf(file, "  \"sequencia\": %llu,\n", (unsigned long long)voo->Sequencia);
     fprintf(file, "  \"passageiros\": [\n");
 
     int isFirst = 1;
@@ -586,8 +2408,13 @@ void salvarVooEmJson(Voo* voo) {
     fprintf(file, "\n  ]\n");
     fprintf(file, "}\n");
 
-    fclose(file);
-    printf("Dados do voo %s salvos/atualizados em '%s'.\n", voo->Id, filename);
+    int falhou = ferror(file);
+    if (fclose(file) != 0 || falhou || rename(tmpname, filename) != 0) {
+        printf("ERRO: Não foi possível gravar o arquivo %s\n", filename);
+        remove(tmpname);
+        return 0;
+    }
+    return 1;
 }
 
 /**
@@ -601,12 +2428,440 @@ void escreverPassageirosJson(FILE* file, PassengersList* root, int* isFirst) {
 
     escreverPassageirosJson(file, root->left, isFirst);
 
-    if (*isFirst) {
-        fprintf(file, "    \"%s\"", root->name);
-        *isFirst = 0;
-    } else {
-        fprintf(file, ",\n    \"%s\"", root->name);
+    fprintf(file, *isFirst ? "    \"" : ",\n    \"");
+    *isFirst = 0;
+    // Aspas e barras no nome precisam de escape para o JSON continuar válido
+    for (const char* c = root->name; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        fputc(*c, file);
     }
+    fputc('"', file);
 
     escreverPassageirosJson(file, root->right, isFirst);
-}
\ No newline at end of file
+}
+
+// =================== JOURNAL ===================
+
+// Limite mínimo de registros antes de compactar o journal num snapshot
+#define JOURNAL_MIN_COMPACTACAO 64
+
+/**
+ * @brief Acrescenta uma alteração do voo ao journal (uma linha, sem reescrever o JSON).
+ * Formato: "A <nome>" para cadastro, "R <nome>" para remoção e
+ * "H <horario> <prioridade> <sequencia>" para a nova posição na agenda. Quando o
+ * journal acumula max(64, passageiros) registros, ele é compactado no snapshot JSON.
+ * @param voo Voo alterado.
+ * @param operacao 'A' (adicionar), 'R' (remover) ou 'H' (agendamento).
+ * @param name Nome do passageiro, ou os campos do agendamento (veja registrarAgendamento).
+ */
+void registrarNoJournal(Voo* voo, char operacao, const char* name) {
+    if (!persistenciaAtiva) return;
+    if (voo->journal == NULL) {
+        char filename[20];
+        snprintf(filename, sizeof(filename), "%s.journal", voo->Registro);
+        voo->journal = fopen(filename, "a");
+        if (voo->journal == NULL) {
+            // Sem journal, cai para o snapshot completo
+            printf("ERRO: Não foi possível abrir o arquivo %s\n", filename);
+            salvarVooEmJson(voo);
+            return;
+        }
+    }
+
+    fprintf(voo->journal, "%c %s\n", operacao, name);
+    fflush(voo->journal);
+    voo->registrosJournal++;
+
+    uint32_t limite = voo->totalPassageiros > JOURNAL_MIN_COMPACTACAO ? voo->totalPassageiros : JOURNAL_MIN_COMPACTACAO;
+    if (voo->registrosJournal >= limite) {
+        compactarVoo(voo);
+    }
+}
+
+/**
+ * @brief Registra no journal o horário, a prioridade e a sequência atuais do voo.
+ * @param voo Voo que mudou de posição na agenda.
+ */
+void registrarAgendamento(Voo* voo) {
+    char campos[48];
+    snprintf(campos, sizeof(campos), "%u %u %llu", voo->Horario, voo->Prioridade,
+             (unsigned long long)voo->Sequencia);
+    registrarNoJournal(voo, 'H', campos);
+}
+
+/**
+ * @brief Grava o snapshot JSON do voo e esvazia o journal, que passa a valer a partir dele.
+ * Se o snapshot não puder ser gravado, o journal fica como está e continua
+ * recebendo registros; a compactação é tentada de novo no próximo registro.
+ * @param voo Voo a ser compactado.
+ */
+void compactarVoo(Voo* voo) {
+    if (!salvarVooEmJson(voo)) return;
+
+    // O snapshot já contém tudo: o journal pode ser truncado
+    fecharJournal(voo);
+    char filename[20];
+    snprintf(filename, sizeof(filename), "%s.journal", voo->Registro);
+    remove(filename);
+    voo->registrosJournal = 0;
+}
+
+/**
+ * @brief Fecha o arquivo de journal do voo, se estiver aberto.
+ * @param voo Voo cujo journal será fechado.
+ */
+void fecharJournal(Voo* voo) {
+    if (voo->journal != NULL) {
+        fclose(voo->journal);
+        voo->journal = NULL;
+    }
+}
+
+/**
+ * @brief Reaplica o journal do voo (<Registro>.journal) sobre os passageiros e o agendamento do snapshot.
+ * Só valem linhas completas (terminadas em '\n'). Uma última linha sem '\n' é de
+ * uma escrita interrompida: ela é ignorada e cortada do arquivo, para que o
+ * próximo registro não seja colado nela.
+ * @param voo Voo recém-carregado do JSON.
+ * @return Quantidade de registros aplicados.
+ */
+uint32_t aplicarJournal(Voo* voo) {
+    char filename[20];
+    snprintf(filename, sizeof(filename), "%s.journal", voo->Registro);
+
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) return 0;
+
+    char linha[64];
+    uint32_t registros = 0;
+    long fimValido = 0; // Posição logo após a última linha completa
+    int cortada = 0;
+    while (fgets(linha, sizeof(linha), file) != NULL) {
+        size_t n = strcspn(linha, "\n");
+        if (linha[n] != '\n') {
+            if (feof(file)) {
+                cortada = 1; // Queda no meio da escrita
+                break;
+            }
+            // Maior que qualquer registro válido: descarta a linha inteira
+            int c;
+            while ((c = getc(file)) != '\n' && c != EOF);
+            if (c == EOF) {
+                cortada = 1;
+                break;
+            }
+            fimValido = ftell(file);
+            continue;
+        }
+        fimValido = ftell(file);
+        linha[n] = '\0';
+
+        // Linha inválida é ignorada
+        if ((linha[0] != 'A' && linha[0] != 'R' && linha[0] != 'H') || linha[1] != ' ') continue;
+
+        if (linha[0] == 'H') {
+            unsigned int horario, prioridade;
+            unsigned long long sequencia;
+            char resto;
+            if (sscanf(linha + 2, "%u %u %llu%c", &horario, &prioridade, &sequencia, &resto) != 3
+                || prioridade < 1 || prioridade > 9) continue;
+            voo->Horario = horario;
+            voo->Prioridade = (uint8_t)prioridade;
+            voo->Sequencia = sequencia;
+        } else if (linha[0] == 'A')
+            voo->lp = cadastrarPassageiro(voo->lp, linha + 2, &voo->totalPassageiros, voo->Assentos);
+        else
+            voo->lp = removerPassageiro(voo->lp, linha + 2, &voo->totalPassageiros);
+        registros++;
+    }
+
+    fclose(file);
+    if (cortada && truncate(filename, fimValido) != 0) {
+        perror("Erro ao cortar a linha incompleta do journal");
+    }
+    return registros;
+}
+
+// Procura "campo": no texto JSON e devolve o ponteiro logo após os dois-pontos
+static const char* acharCampoJson(const char* json, const char* campo) {
+    char padrao[32];
+    snprintf(padrao, sizeof(padrao), "\"%s\"", campo);
+    const char* p = strstr(json, padrao);
+    if (p == NULL) return NULL;
+    p = strchr(p + strlen(padrao), ':');
+    return p ? p + 1 : NULL;
+}
+
+// Lê uma string JSON começando em p (espaços antes das aspas são pulados).
+// Retorna o ponteiro após as aspas finais, ou NULL se a string for inválida.
+static const char* lerStringJson(const char* p, char* destino, size_t tamanho) {
+    while (isspace((unsigned char)*p)) p++;
+    if (*p != '"') return NULL;
+    p++;
+
+    size_t n = 0;
+    while (*p && *p != '"') {
+        if (*p == '\\' && p[1] != '\0') p++;
+        if (n + 1 < tamanho) destino[n++] = *p;
+        p++;
+    }
+    destino[n] = '\0';
+    return *p == '"' ? p + 1 : NULL;
+}
+
+static int lerCampoTexto(const char* json, const char* campo, char* destino, size_t tamanho) {
+    const char* p = acharCampoJson(json, campo);
+    return p != NULL && lerStringJson(p, destino, tamanho) != NULL;
+}
+
+/**
+ * @brief Reconstrói um voo a partir do seu snapshot JSON (formato de salvarVooEmJson).
+ * @param filename Caminho do arquivo <Registro>.json.
+ * @return Voo alocado (fora da fila) ou NULL se o arquivo for inválido.
+ */
+Voo* carregarVooDoJson(const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long tamanho = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (tamanho <= 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    char* json = (char*)malloc((size_t)tamanho + 1);
+    Voo* voo = (Voo*)calloc(1, sizeof(Voo));
+    if (json == NULL || voo == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+    size_t lidos = fread(json, 1, (size_t)tamanho, file);
+    json[lidos] = '\0';
+    fclose(file);
+
+    const char* assentos = acharCampoJson(json, "assentos");
+    const char* passageiros = acharCampoJson(json, "passageiros");
+    // O registro também nomeia o journal lido logo depois
+    if (!lerCampoTexto(json, "registro", voo->Registro, sizeof(voo->Registro))
+        || !registroValido(voo->Registro)
+        || !lerCampoTexto(json, "id_voo", voo->Id, sizeof(voo->Id))
+        || !lerCampoTexto(json, "destino", voo->Destino, sizeof(voo->Destino))
+        || !lerCampoTexto(json, "empresa", voo->Empresa, sizeof(voo->Empresa))
+        || !lerCampoTexto(json, "modelo_aeronave", voo->Modelo, sizeof(voo->Modelo))
+        || assentos == NULL || sscanf(assentos, "%u", &voo->Assentos) != 1
+        || passageiros == NULL) {
+        free(json);
+        free(voo);
+        return NULL;
+    }
+
+    // Arquivos antigos não têm sequência; ficam no começo da fila
+    const char* sequencia = acharCampoJson(json, "sequencia");
+    unsigned long long valorSequencia = 0;
+    if (sequencia != NULL) sscanf(sequencia, "%llu", &valorSequencia);
+    voo->Sequencia = valorSequencia;
+
+    // Sem horário/prioridade (arquivos anteriores à agenda): no começo da agenda,
+    // prioridade padrão. Arquivos só com "HH:MM" ficam para a próxima vez dessa hora
+    char textoHorario[24];
+    unsigned int valorPrioridade = PRIORIDADE_PADRAO;
+    const char* prioridade = acharCampoJson(json, "prioridade");
+    if (!lerCampoTexto(json, "horario", textoHorario, sizeof(textoHorario))
+        || !lerHorario(textoHorario, &voo->Horario)) voo->Horario = 0;
+    if (prioridade != NULL) sscanf(prioridade, "%u", &valorPrioridade);
+    voo->Prioridade = (uint8_t)(valorPrioridade >= 1 && valorPrioridade <= 9 ? valorPrioridade : PRIORIDADE_PADRAO);
+
+    // Passageiros: ["nome", "nome", ...], já em ordem alfabética quando vêm do salvarVooEmJson
+    size_t capacidade = 16;
+    size_t n = 0;
+    char (*nomes)[40] = malloc(capacidade * sizeof(*nomes));
+    ChavePassageiro* chaves = malloc(capacidade * sizeof(ChavePassageiro));
+    int ordenado = 1;
+
+    const char* p = strchr(passageiros, '[');
+    if (p != NULL) p++;
+    while (p != NULL && nomes != NULL && chaves != NULL) {
+        while (isspace((unsigned char)*p) || *p == ',') p++;
+        if (*p != '"') break; // Fim da lista
+
+        if (n == capacidade) {
+            capacidade *= 2;
+            nomes = realloc(nomes, capacidade * sizeof(*nomes));
+            chaves = realloc(chaves, capacidade * sizeof(ChavePassageiro));
+            if (nomes == NULL || chaves == NULL) break;
+        }
+
+        p = lerStringJson(p, nomes[n], sizeof(nomes[n]));
+        if (p == NULL) break;
+        montarChavePassageiro(&chaves[n], nomes[n]);
+        if (n > 0 && compararChaves(&chaves[n - 1], &chaves[n]) >= 0) ordenado = 0;
+        n++;
+    }
+    if (nomes == NULL || chaves == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+
+    if (ordenado && n <= voo->Assentos) {
+        // Caso normal: árvore perfeitamente balanceada montada em O(n)
+        voo->lp = construirArvoreOrdenada(nomes, chaves, n);
+        voo->totalPassageiros = (uint32_t)n;
+    } else {
+        // Arquivo editado à mão: insere um a um (descarta repetidos e excedentes)
+        for (size_t i = 0; i < n; i++)
+            voo->lp = cadastrarPassageiro(voo->lp, nomes[i], &voo->totalPassageiros, voo->Assentos);
+    }
+
+    free(nomes);
+    free(chaves);
+    free(json);
+    return voo;
+}
+
+/**
+ * @brief Monta em O(n) uma árvore AVL balanceada a partir de nomes em ordem estritamente crescente.
+ * @param nomes Nomes dos passageiros, já ordenados pela chave.
+ * @param chaves Chaves correspondentes (montarChavePassageiro).
+ * @param n Quantidade de nomes.
+ * @return Raiz da árvore (NULL se n == 0).
+ */
+PassengersList* construirArvoreOrdenada(char (*nomes)[40], const ChavePassageiro* chaves, size_t n) {
+    if (n == 0) return NULL;
+
+    // O elemento do meio vira a raiz; as metades viram as subárvores
+    size_t meio = n / 2;
+    PassengersList* node = (PassengersList*)malloc(sizeof(PassengersList));
+    if (node == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+    memcpy(node->name, nomes[meio], sizeof(node->name));
+    node->chave = chaves[meio];
+    node->left = construirArvoreOrdenada(nomes, chaves, meio);
+    node->right = construirArvoreOrdenada(nomes + meio + 1, chaves + meio + 1, n - meio - 1);
+    atualizarAltura(node);
+    return node;
+}
+
+// Abaixo disso não compensa criar threads para a carga
+#define CARGA_MIN_ARQUIVOS_POR_THREAD 32
+#define CARGA_MAX_THREADS 16
+
+// Lista de arquivos dividida entre as threads de carga
+typedef struct {
+    char** arquivos;
+    Voo** voos;           // voos[i] = resultado de arquivos[i] (NULL se inválido)
+    size_t total;
+    atomic_size_t proximo; // Próximo arquivo livre
+} CargaVoos;
+
+// Cada thread pega o próximo arquivo da lista até acabar: lê o snapshot e aplica o journal
+static void* trabalharCarga(void* arg) {
+    CargaVoos* carga = (CargaVoos*)arg;
+    size_t i;
+    while ((i = atomic_fetch_add(&carga->proximo, 1)) < carga->total) {
+        Voo* voo = carregarVooDoJson(carga->arquivos[i]);
+        if (voo != NULL) voo->registrosJournal = aplicarJournal(voo);
+        carga->voos[i] = voo;
+    }
+    return NULL;
+}
+
+// Ordem de chegada; com ela, os repetidos descartados são sempre os que chegaram depois
+static int compararSequencia(const void* a, const void* b) {
+    const Voo* x = *(Voo* const*)a;
+    const Voo* y = *(Voo* const*)b;
+    if (x->Sequencia != y->Sequencia) return x->Sequencia < y->Sequencia ? -1 : 1;
+    return strcmp(x->Registro, y->Registro);
+}
+
+/**
+ * @brief Carrega todos os voos salvos no diretório atual (*.json), aplicando o journal de cada um.
+ * Os arquivos são lidos em paralelo quando há muitos; a agenda se remonta pelos
+ * campos "horario", "prioridade" e "sequencia".
+ * @param queue Ponteiro para a fila de voos.
+ */
+void carregarVoos(QueuePlane* queue) {
+    DIR* dir = opendir(".");
+    if (dir == NULL) return;
+
+    CargaVoos carga;
+    size_t capacidade = 64;
+    carga.arquivos = (char**)malloc(capacidade * sizeof(char*));
+    carga.total = 0;
+    atomic_init(&carga.proximo, 0);
+
+    struct dirent* entrada;
+    while ((entrada = readdir(dir)) != NULL) {
+        size_t len = strlen(entrada->d_name);
+        if (len <= 5 || strcmp(entrada->d_name + len - 5, ".json") != 0) continue;
+
+        if (carga.total == capacidade) {
+            capacidade *= 2;
+            carga.arquivos = (char**)realloc(carga.arquivos, capacidade * sizeof(char*));
+        }
+        if (carga.arquivos == NULL || (carga.arquivos[carga.total] = strdup(entrada->d_name)) == NULL) {
+            printf("Erro crítico de alocação de memória.\n");
+            exit(1);
+        }
+        carga.total++;
+    }
+    closedir(dir);
+
+    carga.voos = (Voo**)calloc(carga.total ? carga.total : 1, sizeof(Voo*));
+    if (carga.voos == NULL) {
+        printf("Erro crítico de alocação de memória.\n");
+        exit(1);
+    }
+
+    // Uma thread por núcleo, desde que cada uma tenha arquivos suficientes
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nThreads = carga.total / CARGA_MIN_ARQUIVOS_POR_THREAD;
+    if (nucleos > 0 && nThreads > (size_t)nucleos) nThreads = (size_t)nucleos;
+    if (nThreads > CARGA_MAX_THREADS) nThreads = CARGA_MAX_THREADS;
+
+    pthread_t threads[CARGA_MAX_THREADS];
+    size_t criadas = 0;
+    for (size_t t = 1; t < nThreads; t++) {
+        if (pthread_create(&threads[criadas], NULL, trabalharCarga, &carga) == 0) criadas++;
+    }
+    trabalharCarga(&carga); // A thread principal também trabalha
+    for (size_t t = 0; t < criadas; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    // Compacta os válidos, ordena pela sequência e remonta a fila
+    size_t validos = 0;
+    for (size_t i = 0; i < carga.total; i++) {
+        if (carga.voos[i] == NULL) {
+            printf("Arquivo '%s' ignorado: não é um voo válido.\n", carga.arquivos[i]);
+        } else {
+            carga.voos[validos++] = carga.voos[i];
+        }
+        free(carga.arquivos[i]);
+    }
+    qsort(carga.voos, validos, sizeof(Voo*), compararSequencia);
+
+    int carregados = 0;
+    for (size_t i = 0; i < validos; i++) {
+        Voo* voo = carga.voos[i];
+        if (encontrarVoo(queue, voo->Id) != NULL || encontrarVooPorRegistro(queue, voo->Registro) != NULL) {
+            printf("Arquivo '%s.json' ignorado: voo %s repetido.\n", voo->Registro, voo->Id);
+            liberarPassageiros(voo->lp);
+            free(voo);
+            continue;
+        }
+        if (voo->Sequencia >= queue->proximaSequencia) queue->proximaSequencia = voo->Sequencia + ESPACO_SEQUENCIA;
+        enfileirarVoo(queue, voo);
+        carregados++;
+    }
+
+    free(carga.arquivos);
+    free(carga.voos);
+
+    if (carregados > 0) {
+        printf("%d voo(s) recuperado(s) do disco.\n", carregados);
+    }
+}